@@ -3,49 +3,154 @@
 
 // Auto-generated by manage_assets.py
 
-struct AudioAsset {
-    int command;
+#include <stdint.h>
+
+// Everything here is constexpr: the tables live in flash, lookups cost no
+// RAM and no search. Serial command = event base + tier * 10 + variant.
+// Durations and levels are measured from the clips at generation time, so
+// playback can be scheduled without decoding anything on the board.
+
+enum AudioEvent : uint8_t {
+    AUDIO_BOOT,
+    AUDIO_MOVE_START,
+    AUDIO_COLLISION,
+    AUDIO_STUCK,
+    AUDIO_IDLE_TOO_LONG,
+    AUDIO_RESET,
+    AUDIO_MOVE_STOP,
+    AUDIO_MODE_SWITCH,
+    AUDIO_SAW_HUMAN,
+    AUDIO_RANDOM,
+    AUDIO_EVENT_COUNT
+};
+
+#define AUDIO_TIERS 3
+#define AUDIO_LEVEL_UNKNOWN (-128)
+
+struct AudioClip {
+    uint16_t command;
     const char* filename;
+    uint16_t durationMs;  // 0 = not measured (clip missing)
+    int8_t peakDb;        // dBFS
+    int8_t rmsDb;         // dBFS, loudness
+};
+
+struct AudioRange {
+    uint8_t first;      // index into AUDIO_CLIPS
+    uint8_t count;      // variants
+};
+
+constexpr uint16_t AUDIO_EVENT_BASE[AUDIO_EVENT_COUNT] = {
+    100, 200, 300, 400, 500, 600, 700, 800, 900, 950
 };
 
-const AudioAsset AUDIO_ASSETS[] = {
-    { 100, "/boot_0_0.wav" },
-    { 110, "/boot_1_0.wav" },
-    { 120, "/boot_2_0.wav" },
-    { 200, "/move_start_0_0.wav" },
-    { 210, "/move_start_1_0.wav" },
-    { 220, "/move_start_2_0.wav" },
-    { 300, "/collision_0_0.wav" },
-    { 301, "/collision_0_1.wav" },
-    { 310, "/collision_1_0.wav" },
-    { 311, "/collision_1_1.wav" },
-    { 320, "/collision_2_0.wav" },
-    { 321, "/collision_2_1.wav" },
-    { 322, "/collision_2_2.mov" },
-    { 400, "/stuck_0_0.wav" },
-    { 410, "/stuck_1_0.wav" },
-    { 420, "/stuck_2_0.wav" },
-    { 421, "/stuck_2_1.mp3" },
-    { 500, "/idle_too_long_0_0.wav" },
-    { 510, "/idle_too_long_1_0.wav" },
-    { 520, "/idle_too_long_2_0.wav" },
-    { 600, "/reset_0_0.wav" },
-    { 610, "/reset_1_0.wav" },
-    { 620, "/reset_2_0.wav" },
-    { 700, "/move_stop_0_0.wav" },
-    { 710, "/move_stop_1_0.wav" },
-    { 720, "/move_stop_2_0.wav" },
-    { 800, "/mode_switch_0_0.wav" },
-    { 810, "/mode_switch_1_0.wav" },
-    { 820, "/mode_switch_2_0.wav" },
-    { 900, "/saw_human_0_0.wav" },
-    { 910, "/saw_human_1_0.wav" },
-    { 920, "/saw_human_2_0.mp3" },
-    { 950, "/random_0_0.mp3" },
-    { 960, "/random_1_0.mov" },
-    { 970, "/random_2_0.mp3" },
-    { 971, "/random_2_1.mov" },
-    { -1, "" } // Sentinel
+constexpr AudioClip AUDIO_CLIPS[] = {
+    { 100, "/boot_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 110, "/boot_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 120, "/boot_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 200, "/move_start_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 210, "/move_start_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 220, "/move_start_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 300, "/collision_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 301, "/collision_0_1.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 310, "/collision_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 311, "/collision_1_1.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 320, "/collision_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 321, "/collision_2_1.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 322, "/collision_2_2.mp3", 5407, 0, -17 },
+    { 400, "/stuck_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 410, "/stuck_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 420, "/stuck_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 421, "/stuck_2_1.mp3", 6765, -2, -21 },
+    { 500, "/idle_too_long_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 510, "/idle_too_long_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 520, "/idle_too_long_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 600, "/reset_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 610, "/reset_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 620, "/reset_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 700, "/move_stop_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 710, "/move_stop_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 720, "/move_stop_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 800, "/mode_switch_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 810, "/mode_switch_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 820, "/mode_switch_2_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 900, "/saw_human_0_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 910, "/saw_human_1_0.wav", 0, AUDIO_LEVEL_UNKNOWN, AUDIO_LEVEL_UNKNOWN },
+    { 920, "/saw_human_2_0.mp3", 5694, -4, -20 },
+    { 950, "/random_0_0.mp3", 2064, -2, -17 },
+    { 960, "/random_1_0.mp3", 12591, -6, -22 },
+    { 970, "/random_2_0.mp3", 6086, 0, -12 },
+    { 971, "/random_2_1.mp3", 6295, -2, -22 },
+};
+
+#define AUDIO_CLIP_COUNT (sizeof(AUDIO_CLIPS) / sizeof(AUDIO_CLIPS[0]))
+
+constexpr AudioRange AUDIO_RANGES[AUDIO_EVENT_COUNT][AUDIO_TIERS] = {
+    { { 0, 1 }, { 1, 1 }, { 2, 1 } },   // BOOT
+    { { 3, 1 }, { 4, 1 }, { 5, 1 } },   // MOVE_START
+    { { 6, 2 }, { 8, 2 }, { 10, 3 } },   // COLLISION
+    { { 13, 1 }, { 14, 1 }, { 15, 2 } },   // STUCK
+    { { 17, 1 }, { 18, 1 }, { 19, 1 } },   // IDLE_TOO_LONG
+    { { 20, 1 }, { 21, 1 }, { 22, 1 } },   // RESET
+    { { 23, 1 }, { 24, 1 }, { 25, 1 } },   // MOVE_STOP
+    { { 26, 1 }, { 27, 1 }, { 28, 1 } },   // MODE_SWITCH
+    { { 29, 1 }, { 30, 1 }, { 31, 1 } },   // SAW_HUMAN
+    { { 32, 1 }, { 33, 1 }, { 34, 2 } },   // RANDOM
 };
 
+// Variant `variant` (wraps) of (event, tier); pass any random number to
+// pick one at random
+constexpr const AudioClip& audioClip(AudioEvent e, uint8_t tier, uint32_t variant) {
+    return AUDIO_CLIPS[AUDIO_RANGES[e][tier].first + variant % AUDIO_RANGES[e][tier].count];
+}
+
+constexpr uint8_t audioVariants(AudioEvent e, uint8_t tier) {
+    return AUDIO_RANGES[e][tier].count;
+}
+
+constexpr uint16_t audioMaxMs(uint16_t a, uint16_t b) {
+    return a > b ? a : b;
+}
+
+// Longest variant of (event, tier): how long a randomly picked line can run
+constexpr uint16_t audioLongestMs(AudioEvent e, uint8_t tier, uint8_t v = 0) {
+    return v >= AUDIO_RANGES[e][tier].count ? 0
+         : audioMaxMs(AUDIO_CLIPS[AUDIO_RANGES[e][tier].first + v].durationMs, audioLongestMs(e, tier, v + 1));
+}
+
+// --- Build-time checks ---
+
+constexpr bool audioEndsWith(const char* s, const char* suffix, uint8_t n, uint8_t m) {
+    return m == 0 ? true
+         : n == 0 ? false
+         : s[n - 1] == suffix[m - 1] && audioEndsWith(s, suffix, n - 1, m - 1);
+}
+
+constexpr uint8_t audioLen(const char* s) {
+    return *s == '\0' ? 0 : 1 + audioLen(s + 1);
+}
+
+constexpr bool audioPlayable(const char* f) {
+    return audioEndsWith(f, ".mp3", audioLen(f), 4) || audioEndsWith(f, ".wav", audioLen(f), 4);
+}
+
+constexpr bool audioAllPlayable(uint8_t i) {
+    return i >= AUDIO_CLIP_COUNT ? true : audioPlayable(AUDIO_CLIPS[i].filename) && audioAllPlayable(i + 1);
+}
+
+// Every tier of every event has a clip, and each run holds its own
+// (event, tier)'s commands
+constexpr bool audioRangeOk(uint8_t e, uint8_t t, uint8_t v) {
+    return v >= AUDIO_RANGES[e][t].count ? AUDIO_RANGES[e][t].count > 0
+         : AUDIO_CLIPS[AUDIO_RANGES[e][t].first + v].command == AUDIO_EVENT_BASE[e] + t * 10 + v && audioRangeOk(e, t, v + 1);
+}
+
+constexpr bool audioTiersComplete(uint8_t i) {
+    return i >= AUDIO_EVENT_COUNT * AUDIO_TIERS ? true
+         : audioRangeOk(i / AUDIO_TIERS, i % AUDIO_TIERS, 0) && audioTiersComplete(i + 1);
+}
+
+static_assert(audioAllPlayable(0), "audio_map.h: a clip isn't MP3/WAV (convert it into assets/audio/ref/, re-run manage_assets.py)");
+static_assert(audioTiersComplete(0), "audio_map.h: an event is missing a tier (add a line in lines_sheldon.py)");
+
 #endif // AUDIO_MAP_H
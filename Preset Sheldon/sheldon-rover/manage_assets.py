@@ -15,6 +15,10 @@ from difflib import SequenceMatcher
 sys.path.append(os.path.dirname(os.path.abspath(__file__)))
 from lines_sheldon import LINES
 
+# Clip duration/level analysis is shared with the esp32-server scripts
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'esp32-server', 'esp32-server', 'scripts'))
+from clip_meta import analyze, warn_if_no_decoder
+
 BASE_DIR = os.path.dirname(os.path.abspath(__file__))
 ASSETS_DIR = os.path.join(BASE_DIR, 'assets')
 AUDIO_DIR = os.path.join(ASSETS_DIR, 'audio')
@@ -116,39 +120,178 @@ def sync_database():
     print(f"Database updated! {len(new_rows)} entries written to {DATABASE_FILE}")
     return new_rows
 
+# What the ESP32's player can decode. A clip in anything else (.mov from
+# the phone) plays from its MP3 in assets/audio/ref/ if there is one.
+ESP32_FORMATS = ('.mp3', '.wav')
+REF_DIR = os.path.join(AUDIO_DIR, 'ref')
+
+def esp32_filename(row):
+    name = row['audio_filename']
+    stem, ext = os.path.splitext(name)
+    if ext.lower() in ESP32_FORMATS:
+        return name
+    if os.path.exists(os.path.join(REF_DIR, stem + '.mp3')):
+        return stem + '.mp3'
+    print(f"WARNING: {name} can't play on the ESP32 and has no ref/{stem}.mp3 (audio_map.h won't compile)")
+    return name
+
+def clip_path(name):
+    for folder in (AUDIO_DIR, REF_DIR):
+        if os.path.exists(os.path.join(folder, name)):
+            return os.path.join(folder, name)
+    return None
+
+# Duration and whole-dB levels for AUDIO_CLIPS; a clip that isn't on disk
+# (or can't be decoded) gets 0 ms / AUDIO_LEVEL_UNKNOWN
+def clip_meta(name):
+    path = clip_path(name)
+    meta = analyze(path) if path else {'ms': 0}
+    if meta['ms'] > 0xFFFF:
+        sys.exit(f"audio_map.h: {name} is over 65 s, widen AudioClip.durationMs")
+    level = lambda key: str(round(meta[key])) if key in meta else "AUDIO_LEVEL_UNKNOWN"
+    return meta['ms'], level('peak'), level('rms')
+
 def export_esp32(db_rows):
     if not os.path.exists(ESP_DIST_DIR):
         os.makedirs(ESP_DIST_DIR)
     
     print("Exporting for ESP32...")
-    
-    # Sort by serial command for cleanliness
-    sorted_rows = sorted(db_rows, key=lambda x: int(x['serial_command']))
-    
-    header_content = """#ifndef AUDIO_MAP_H
+
+    # Events in serial-command order, tiers 0..max; each (event, tier) gets a
+    # contiguous run of variants in AUDIO_CLIPS
+    events = sorted(set(CATEGORY_MAP), key=lambda c: CATEGORY_MAP[c])
+    tiers = 1 + max(int(row['intensity']) for row in db_rows)
+    groups = {}
+    for row in db_rows:
+        groups.setdefault((row['category'], int(row['intensity'])), []).append(row)
+
+    clips = []
+    ranges = []
+    for event in events:
+        tier_ranges = []
+        for tier in range(tiers):
+            rows = sorted(groups.get((event, tier), []), key=lambda r: int(r['index']))
+            tier_ranges.append((len(clips), len(rows)))
+            clips += rows
+        ranges.append(tier_ranges)
+    if len(clips) > 255:
+        sys.exit("audio_map.h: more than 255 clips, widen AudioRange")
+    names = [esp32_filename(row) for row in clips]
+    warn_if_no_decoder([p for p in map(clip_path, names) if p])
+
+    out = []
+    out.append("""#ifndef AUDIO_MAP_H
 #define AUDIO_MAP_H
 
 // Auto-generated by manage_assets.py
 
-struct AudioAsset {
-    int command;
+#include <stdint.h>
+
+// Everything here is constexpr: the tables live in flash, lookups cost no
+// RAM and no search. Serial command = event base + tier * 10 + variant.
+// Durations and levels are measured from the clips at generation time, so
+// playback can be scheduled without decoding anything on the board.
+""")
+    out.append("enum AudioEvent : uint8_t {")
+    for event in events:
+        out.append(f"    AUDIO_{event},")
+    out.append("    AUDIO_EVENT_COUNT")
+    out.append("};")
+    out.append("")
+    out.append(f"#define AUDIO_TIERS {tiers}")
+    out.append("#define AUDIO_LEVEL_UNKNOWN (-128)")
+    out.append("")
+    out.append("""struct AudioClip {
+    uint16_t command;
     const char* filename;
+    uint16_t durationMs;  // 0 = not measured (clip missing)
+    int8_t peakDb;        // dBFS
+    int8_t rmsDb;         // dBFS, loudness
 };
 
-const AudioAsset AUDIO_ASSETS[] = {
-"""
-    
-    for row in sorted_rows:
-        header_content += f"    {{ {row['serial_command']}, \"/{row['audio_filename']}\" }},\n"
-        
-    header_content += """    { -1, "" } // Sentinel
+struct AudioRange {
+    uint8_t first;      // index into AUDIO_CLIPS
+    uint8_t count;      // variants
 };
+""")
+    out.append("constexpr uint16_t AUDIO_EVENT_BASE[AUDIO_EVENT_COUNT] = {")
+    out.append("    " + ", ".join(str(CATEGORY_MAP[e]) for e in events))
+    out.append("};")
+    out.append("")
+    out.append("constexpr AudioClip AUDIO_CLIPS[] = {")
+    for row, name in zip(clips, names):
+        ms, peak, rms = clip_meta(name)
+        out.append(f"    {{ {row['serial_command']}, \"/{name}\", {ms}, {peak}, {rms} }},")
+    out.append("};")
+    out.append("")
+    out.append("#define AUDIO_CLIP_COUNT (sizeof(AUDIO_CLIPS) / sizeof(AUDIO_CLIPS[0]))")
+    out.append("")
+    out.append("constexpr AudioRange AUDIO_RANGES[AUDIO_EVENT_COUNT][AUDIO_TIERS] = {")
+    for event, tier_ranges in zip(events, ranges):
+        cells = ", ".join(f"{{ {first}, {count} }}" for first, count in tier_ranges)
+        out.append(f"    {{ {cells} }},   // {event}")
+    out.append("};")
+    out.append("""
+// Variant `variant` (wraps) of (event, tier); pass any random number to
+// pick one at random
+constexpr const AudioClip& audioClip(AudioEvent e, uint8_t tier, uint32_t variant) {
+    return AUDIO_CLIPS[AUDIO_RANGES[e][tier].first + variant % AUDIO_RANGES[e][tier].count];
+}
+
+constexpr uint8_t audioVariants(AudioEvent e, uint8_t tier) {
+    return AUDIO_RANGES[e][tier].count;
+}
+
+constexpr uint16_t audioMaxMs(uint16_t a, uint16_t b) {
+    return a > b ? a : b;
+}
+
+// Longest variant of (event, tier): how long a randomly picked line can run
+constexpr uint16_t audioLongestMs(AudioEvent e, uint8_t tier, uint8_t v = 0) {
+    return v >= AUDIO_RANGES[e][tier].count ? 0
+         : audioMaxMs(AUDIO_CLIPS[AUDIO_RANGES[e][tier].first + v].durationMs, audioLongestMs(e, tier, v + 1));
+}
+
+// --- Build-time checks ---
+
+constexpr bool audioEndsWith(const char* s, const char* suffix, uint8_t n, uint8_t m) {
+    return m == 0 ? true
+         : n == 0 ? false
+         : s[n - 1] == suffix[m - 1] && audioEndsWith(s, suffix, n - 1, m - 1);
+}
+
+constexpr uint8_t audioLen(const char* s) {
+    return *s == '\\0' ? 0 : 1 + audioLen(s + 1);
+}
+
+constexpr bool audioPlayable(const char* f) {""")
+    checks = " || ".join(f'audioEndsWith(f, "{ext}", audioLen(f), {len(ext)})' for ext in ESP32_FORMATS)
+    out.append(f"    return {checks};")
+    out.append("""}
+
+constexpr bool audioAllPlayable(uint8_t i) {
+    return i >= AUDIO_CLIP_COUNT ? true : audioPlayable(AUDIO_CLIPS[i].filename) && audioAllPlayable(i + 1);
+}
+
+// Every tier of every event has a clip, and each run holds its own
+// (event, tier)'s commands
+constexpr bool audioRangeOk(uint8_t e, uint8_t t, uint8_t v) {
+    return v >= AUDIO_RANGES[e][t].count ? AUDIO_RANGES[e][t].count > 0
+         : AUDIO_CLIPS[AUDIO_RANGES[e][t].first + v].command == AUDIO_EVENT_BASE[e] + t * 10 + v && audioRangeOk(e, t, v + 1);
+}
+
+constexpr bool audioTiersComplete(uint8_t i) {
+    return i >= AUDIO_EVENT_COUNT * AUDIO_TIERS ? true
+         : audioRangeOk(i / AUDIO_TIERS, i % AUDIO_TIERS, 0) && audioTiersComplete(i + 1);
+}
+
+static_assert(audioAllPlayable(0), "audio_map.h: a clip isn't MP3/WAV (convert it into assets/audio/ref/, re-run manage_assets.py)");
+static_assert(audioTiersComplete(0), "audio_map.h: an event is missing a tier (add a line in lines_sheldon.py)");
 
-#endif // AUDIO_MAP_H
-"""
+#endif // AUDIO_MAP_H""")
 
     with open(HEADER_FILE, 'w') as f:
-        f.write(header_content)
+        f.write("\n".join(out) + "\n")
         
     print(f"Generated {HEADER_FILE}")
 
@@ -1,18 +0,0 @@
-// ArduinoJson - https://arduinojson.org
-// Copyright © 2014-2025, Benoit BLANCHON
-// MIT License
-
-#pragma once
-
-#include "integral_constant.hpp"
-
-ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
-
-// A meta-function that returns true if types T and U are the same.
-template <typename T, typename U>
-struct is_same : false_type {};
-
-template <typename T>
-struct is_same<T, T> : true_type {};
-
-ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -1,44 +0,0 @@
-// ArduinoJson - https://arduinojson.org
-// Copyright © 2014-2025, Benoit BLANCHON
-// MIT License
-
-#pragma once
-
-#include "type_identity.hpp"
-ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
-
-template <typename T>
-struct make_unsigned;
-
-template <>
-struct make_unsigned<char> : type_identity<unsigned char> {};
-
-template <>
-struct make_unsigned<signed char> : type_identity<unsigned char> {};
-template <>
-struct make_unsigned<unsigned char> : type_identity<unsigned char> {};
-
-template <>
-struct make_unsigned<signed short> : type_identity<unsigned short> {};
-template <>
-struct make_unsigned<unsigned short> : type_identity<unsigned short> {};
-
-template <>
-struct make_unsigned<signed int> : type_identity<unsigned int> {};
-template <>
-struct make_unsigned<unsigned int> : type_identity<unsigned int> {};
-
-template <>
-struct make_unsigned<signed long> : type_identity<unsigned long> {};
-template <>
-struct make_unsigned<unsigned long> : type_identity<unsigned long> {};
-
-template <>
-struct make_unsigned<signed long long> : type_identity<unsigned long long> {};
-template <>
-struct make_unsigned<unsigned long long> : type_identity<unsigned long long> {};
-
-template <typename T>
-using make_unsigned_t = typename make_unsigned<T>::type;
-
-ARDUINOJSON_END_PRIVATE_NAMESPACE
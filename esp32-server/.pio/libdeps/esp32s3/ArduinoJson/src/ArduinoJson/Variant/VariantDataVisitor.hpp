@@ -1,24 +0,0 @@
-// ArduinoJson - https://arduinojson.org
-// Copyright © 2014-2025, Benoit BLANCHON
-// MIT License
-
-#pragma once
-
-#include <ArduinoJson/Array/ArrayData.hpp>
-#include <ArduinoJson/Numbers/JsonFloat.hpp>
-#include <ArduinoJson/Numbers/JsonInteger.hpp>
-#include <ArduinoJson/Object/ObjectData.hpp>
-
-ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
-
-template <typename TResult>
-struct VariantDataVisitor {
-  using result_type = TResult;
-
-  template <typename T>
-  TResult visit(const T&) {
-    return TResult();
-  }
-};
-
-ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -0,0 +1,123 @@
+import math
+import shutil
+import struct
+import subprocess
+import sys
+import wave
+from array import array
+
+# Per-clip metadata for the generated indexes (audio_map.json, audio_map.h,
+# clips.sra): duration from the MP3 frame headers / WAV data size, and peak
+# and RMS level in dBFS from the decoded samples. The firmware schedules
+# from these instead of decoding anything on the rover.
+#
+# WAV (16-bit PCM) is read directly; MP3 goes through ffmpeg if it's on the
+# PATH. Without it MP3 clips still get a duration, just no levels.
+
+SILENCE_DB = -96.0  # 16-bit floor
+
+# MPEG audio: bitrate (kbps) by [version 1 or 2/2.5][index], sample rate by
+# [version bits][index]; Layer III only
+BITRATES = {
+    1: [0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320],
+    2: [0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160],
+}
+SAMPLE_RATES = {3: [44100, 48000, 32000], 2: [22050, 24000, 16000], 0: [11025, 12000, 8000]}
+
+
+def mp3_duration_ms(data):
+    pos = 0
+    if data[:3] == b"ID3":
+        size = (data[6] << 21) | (data[7] << 14) | (data[8] << 7) | data[9]
+        pos = 10 + size
+    samples = 0
+    rate = 0
+    while pos + 4 <= len(data):
+        h = struct.unpack(">I", data[pos:pos + 4])[0]
+        version = (h >> 19) & 3
+        layer = (h >> 17) & 3
+        br_index = (h >> 12) & 15
+        sr_index = (h >> 10) & 3
+        if (h >> 21) != 0x7FF or version == 1 or layer != 1 or br_index in (0, 15) or sr_index == 3:
+            pos += 1  # not a Layer III frame header: resync
+            continue
+        bitrate = BITRATES[1 if version == 3 else 2][br_index] * 1000
+        rate = SAMPLE_RATES[version][sr_index]
+        per_frame = 1152 if version == 3 else 576
+        length = per_frame // 8 * bitrate // rate + ((h >> 9) & 1)
+        samples += per_frame
+        pos += length
+    return samples * 1000 // rate if rate else 0
+
+
+def wav_duration_ms(data):
+    pos = 12
+    byte_rate = 0
+    while pos + 8 <= len(data):
+        tag, size = struct.unpack("<4sI", data[pos:pos + 8])
+        if tag == b"fmt ":
+            byte_rate = struct.unpack("<I", data[pos + 16:pos + 20])[0]
+        elif tag == b"data" and byte_rate:
+            return size * 1000 // byte_rate
+        pos += 8 + size + (size & 1)
+    return 0
+
+
+def duration_ms(path, data):
+    return wav_duration_ms(data) if path.lower().endswith(".wav") else mp3_duration_ms(data)
+
+
+def _samples(raw):
+    pcm = array("h")
+    pcm.frombytes(raw[:len(raw) & ~1])
+    if sys.byteorder == "big":
+        pcm.byteswap()
+    return pcm
+
+
+def _decode(path):
+    if path.lower().endswith(".wav"):
+        try:
+            with wave.open(path, "rb") as w:
+                if w.getsampwidth() != 2:
+                    return None
+                return _samples(w.readframes(w.getnframes()))
+        except (wave.Error, EOFError):
+            return None
+    ffmpeg = shutil.which("ffmpeg")
+    if not ffmpeg:
+        return None
+    out = subprocess.run([ffmpeg, "-v", "error", "-i", path, "-f", "s16le", "-"], capture_output=True)
+    return _samples(out.stdout) if out.returncode == 0 else None
+
+
+def _dbfs(level):
+    return round(max(SILENCE_DB, 20 * math.log10(level / 32768)), 1) + 0.0 if level > 0 else SILENCE_DB  # no -0.0
+
+
+def levels(path):
+    """(peak, rms) in dBFS, or None if the clip can't be decoded here."""
+    pcm = _decode(path)
+    if pcm is None:
+        return None
+    if not pcm:
+        return SILENCE_DB, SILENCE_DB
+    peak = max(max(pcm), -min(pcm))
+    rms = math.sqrt(sum(s * s for s in pcm) / len(pcm))
+    return _dbfs(peak), _dbfs(rms)
+
+
+def analyze(path):
+    """{"ms": duration, "peak": dBFS, "rms": dBFS}; no levels if undecodable."""
+    with open(path, "rb") as f:
+        data = f.read()
+    meta = {"ms": duration_ms(path, data)}
+    lv = levels(path)
+    if lv:
+        meta["peak"], meta["rms"] = lv
+    return meta
+
+
+def warn_if_no_decoder(paths):
+    if any(not p.lower().endswith(".wav") for p in paths) and not shutil.which("ffmpeg"):
+        print("WARNING: ffmpeg not found, MP3 clips get a duration but no peak/RMS")
@@ -1,9 +1,9 @@
 import os
 import shutil
-import json
+
+from generate_map import generate_map
 
 DATA_DIR = "esp32-server/data"
-MAP_FILE = os.path.join(DATA_DIR, "audio_map.json")
 
 def shorten_filenames():
     new_map = {}
@@ -46,10 +46,8 @@ def shorten_filenames():
             
             new_map[category].append(new_name)
 
-    # 2. Write new map
-    with open(MAP_FILE, 'w') as f:
-        json.dump(new_map, f, indent=2)
-    
+    # 2. Write new map (with each clip's metadata)
+    generate_map()
     print("Files Renamed & Map Updated.")
 
 if __name__ == "__main__":
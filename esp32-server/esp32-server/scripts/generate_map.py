@@ -1,20 +1,34 @@
 import os
 import json
 
+from clip_meta import analyze, warn_if_no_decoder
+
 DATA_DIR = "esp32-server/data"
 OUTPUT_FILE = "esp32-server/data/audio_map.json"
 
+# Category -> clips, each with its precomputed metadata:
+#   { "COLLISION": [ {"file": "collision_1.mp3", "ms": 2403, "peak": -0.4, "rms": -17.9}, ... ] }
+# ms is the clip's length, peak/rms its level in dBFS (left out if it
+# couldn't be decoded). The firmware times cooldowns and maneuvers from ms;
+# the voice page evens out volume from rms.
+
 def generate_map():
     audio_map = {}
-    
+    paths = []
+
     for root, dirs, files in os.walk(DATA_DIR):
         category = os.path.basename(root)
         if root == DATA_DIR: continue # Skip root
-        
-        audio_files = [f for f in files if f.endswith('.mp3')]
+
+        audio_files = sorted(f for f in files if f.endswith('.mp3'))
         if audio_files:
-            audio_map[category] = audio_files
+            audio_map[category] = []
+            for name in audio_files:
+                path = os.path.join(root, name)
+                paths.append(path)
+                audio_map[category].append(dict(file=name, **analyze(path)))
 
+    warn_if_no_decoder(paths)
     with open(OUTPUT_FILE, 'w') as f:
         json.dump(audio_map, f, indent=2)
     
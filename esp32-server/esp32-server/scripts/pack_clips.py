@@ -0,0 +1,109 @@
+import os
+import shutil
+import struct
+import sys
+
+from clip_meta import duration_ms
+
+# Packs data/<CATEGORY>/*.mp3 (and .wav) into one archive, clips.sra, that
+# the firmware serves clips from (format in src/clip_archive.h).
+# Run from the repo root, like the other scripts:
+#   python3 esp32-server/esp32-server/scripts/pack_clips.py [data dir] [out]
+# Without [out] it stages a filesystem image in esp32-server/build/data: the
+# archive plus everything in data/ except the category folders, so the clips
+# aren't in the image twice. Upload that one from esp32-server/ with
+#   PLATFORMIO_DATA_DIR=build/data pio run --target uploadfs
+
+DATA_DIR = "esp32-server/data"
+BUILD_DIR = "esp32-server/build/data"
+OUT_NAME = "clips.sra"
+
+MAGIC = b"SRA1"
+CATEGORY_SIZE = 16
+ENTRY_SIZE = 48
+NAME_MAX = 32
+CODECS = {".mp3": 1, ".wav": 2}
+FS_BLOCK = 4096  # LittleFS block: a loose file takes whole ones
+
+# What the firmware's index holds (src/storage.h); past these it would cut
+# names short or drop clips without a word, so refuse to pack instead
+ASSET_MAX = 64
+ASSET_PATH_MAX = 40  # "/<category>/<name>" + NUL
+ASSET_CAT_MAX = 8
+ASSET_CAT_NAME = 16  # + NUL
+
+
+def collect(data_dir):
+    clips = []
+    categories = sorted(d for d in os.listdir(data_dir) if os.path.isdir(os.path.join(data_dir, d)))
+    if len(categories) > ASSET_CAT_MAX:
+        sys.exit(f"too many categories (max {ASSET_CAT_MAX}): {', '.join(categories)}")
+    for c, category in enumerate(categories):
+        if len(category.encode()) > ASSET_CAT_NAME - 1:
+            sys.exit(f"category name too long (max {ASSET_CAT_NAME - 1}): {category}")
+        folder = os.path.join(data_dir, category)
+        for name in sorted(os.listdir(folder)):
+            ext = os.path.splitext(name)[1].lower()
+            if ext not in CODECS:
+                continue
+            if len(name.encode()) > NAME_MAX:
+                sys.exit(f"clip name too long (max {NAME_MAX}): {name}")
+            path = f"/{category}/{name}"
+            if len(path.encode()) > ASSET_PATH_MAX - 1:
+                sys.exit(f"clip path too long (max {ASSET_PATH_MAX - 1}): {path}")
+            with open(os.path.join(folder, name), "rb") as f:
+                data = f.read()
+            duration = duration_ms(name, data)
+            clips.append((c, CODECS[ext], name, data, duration))
+    return categories, clips
+
+
+def pack(data_dir, out_path):
+    categories, clips = collect(data_dir)
+    if len(clips) > ASSET_MAX:
+        sys.exit(f"too many clips (max {ASSET_MAX}): {len(clips)}")
+
+    data_offset = 12 + CATEGORY_SIZE * len(categories) + ENTRY_SIZE * len(clips)
+    out = bytearray(MAGIC + struct.pack("<HBBI", len(clips), len(categories), 0, data_offset))
+    for category in categories:
+        out += category.encode().ljust(CATEGORY_SIZE, b"\0")
+
+    offset = data_offset
+    for i, (c, codec, name, data, duration) in enumerate(clips):
+        out += struct.pack("<HBBIII", i, c, codec, offset, len(data), duration)
+        out += name.encode().ljust(NAME_MAX, b"\0")
+        offset += len(data)
+    for clip in clips:
+        out += clip[3]
+
+    with open(out_path, "wb") as f:
+        f.write(out)
+
+    loose = sum(len(clip[3]) for clip in clips)
+    loose_blocks = sum((len(clip[3]) + FS_BLOCK - 1) // FS_BLOCK for clip in clips)
+    print(f"Packed {len(clips)} clips in {len(categories)} categories -> {out_path}")
+    print(f"  {loose} bytes of audio, {len(out) - loose} bytes of index")
+    print(f"  LittleFS blocks: {loose_blocks} loose (+ directories) vs {(len(out) + FS_BLOCK - 1) // FS_BLOCK} packed")
+    for c, codec, name, data, duration in clips:
+        print(f"  {categories[c]}/{name}: {len(data)} bytes, {duration} ms")
+
+
+def stage(data_dir, build_dir):
+    """Fresh image dir: the archive and data/'s top-level files, no clip folders."""
+    if os.path.isdir(build_dir):
+        shutil.rmtree(build_dir)
+    os.makedirs(build_dir)
+    pack(data_dir, os.path.join(build_dir, OUT_NAME))
+    for name in sorted(os.listdir(data_dir)):
+        src = os.path.join(data_dir, name)
+        if os.path.isfile(src) and name != OUT_NAME:
+            shutil.copy2(src, build_dir)
+    print(f"Staged filesystem image in {build_dir}")
+
+
+if __name__ == "__main__":
+    data_dir = sys.argv[1] if len(sys.argv) > 1 else DATA_DIR
+    if len(sys.argv) > 2:
+        pack(data_dir, sys.argv[2])
+    else:
+        stage(data_dir, BUILD_DIR)
@@ -0,0 +1,146 @@
+// Host build of the clip archive reader (src/clip_archive.cpp) with a file
+// descriptor and pread() standing in for the LittleFS handle. Checks every
+// clip in the archive against its loose file, then times serving clips
+// both ways in 2 KB chunks like handleAudio(): open/read/close per clip
+// from the category tree, against positioned reads on the one open archive.
+//
+//   g++ -O2 -I src examples/archive_host.cpp src/clip_archive.cpp -o archive_host
+//   python3 esp32-server/scripts/pack_clips.py data /tmp/clips.sra
+//   ./archive_host data /tmp/clips.sra [rounds]
+//
+// Linux's page cache makes both layouts cheaper than on flash; what's left
+// is the per-clip path lookup and open/close that the archive avoids.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <vector>
+#include "clip_archive.h"
+
+#define CHUNK 2048
+
+class FdSource : public ClipSource {
+public:
+    explicit FdSource(int fd) : fd_(fd) {}
+    uint32_t size() override {
+        struct stat st;
+        return fstat(fd_, &st) == 0 ? (uint32_t)st.st_size : 0;
+    }
+    bool readAt(uint32_t offset, void* buf, size_t len) override {
+        return pread(fd_, buf, len, offset) == (ssize_t)len;
+    }
+
+private:
+    int fd_;
+};
+
+struct Clip {
+    ClipEntry entry;
+    char path[256];
+};
+
+static uint32_t checksum(const uint8_t* p, size_t n, uint32_t h) {
+    for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+// Both return the checksum when asked, else the byte count (timed runs)
+static uint32_t readLoose(const char* path, uint8_t* buf, bool hash) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    uint32_t h = 2166136261u, n = 0;
+    ssize_t got;
+    while ((got = read(fd, buf, CHUNK)) > 0) {
+        if (hash) h = checksum(buf, got, h);
+        n += got;
+    }
+    close(fd);
+    return hash ? h : n;
+}
+
+static uint32_t readPacked(ClipArchive& a, const ClipEntry& e, uint8_t* buf, bool hash) {
+    uint32_t h = 2166136261u, n = 0;
+    for (uint32_t pos = 0; pos < e.length; pos += CHUNK) {
+        size_t got = a.read(e, pos, buf, CHUNK);
+        if (got == 0) break;
+        if (hash) h = checksum(buf, got, h);
+        n += got;
+    }
+    return hash ? h : n;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <data dir> <archive> [rounds]\n", argv[0]);
+        return 2;
+    }
+    const char* dataDir = argv[1];
+    int rounds = argc > 3 ? atoi(argv[3]) : 200;
+
+    int fd = open(argv[2], O_RDONLY);
+    if (fd < 0) {
+        perror(argv[2]);
+        return 1;
+    }
+    FdSource src(fd);
+    ClipArchive archive;
+    if (!archive.open(&src)) {
+        fprintf(stderr, "archive: %s\n", archive.error());
+        return 1;
+    }
+
+    std::vector<Clip> clips(archive.clipCount());
+    uint64_t bytes = 0;
+    for (uint16_t i = 0; i < archive.clipCount(); i++) {
+        char cat[CLIP_CATEGORY_SIZE + 1];
+        if (!archive.entry(i, clips[i].entry) || !archive.category(clips[i].entry.category, cat)) {
+            fprintf(stderr, "archive: %s\n", archive.error());
+            return 1;
+        }
+        snprintf(clips[i].path, sizeof(clips[i].path), "%s/%s/%s", dataDir, cat, clips[i].entry.name);
+        bytes += clips[i].entry.length;
+    }
+
+    static uint8_t buf[CHUNK];
+    for (const Clip& c : clips) {
+        if (readLoose(c.path, buf, true) != readPacked(archive, c.entry, buf, true)) {
+            fprintf(stderr, "mismatch: %s\n", c.path);
+            return 1;
+        }
+    }
+    printf("%zu clips, %llu bytes, all match their loose files\n", clips.size(), (unsigned long long)bytes);
+
+    // Same pseudo-random clip order for both
+    std::vector<uint16_t> order;
+    uint32_t rng = 1;
+    for (int r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < clips.size(); i++) {
+            rng = rng * 1103515245u + 12345u;
+            order.push_back((rng >> 16) % clips.size());
+        }
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    uint64_t looseBytes = 0, packedBytes = 0;
+    Clock::time_point t0 = Clock::now();
+    for (uint16_t i : order) looseBytes += readLoose(clips[i].path, buf, false);
+    Clock::time_point t1 = Clock::now();
+    for (uint16_t i : order) packedBytes += readPacked(archive, clips[i].entry, buf, false);
+    Clock::time_point t2 = Clock::now();
+    if (looseBytes != packedBytes) {
+        fprintf(stderr, "read %llu loose vs %llu packed bytes\n", (unsigned long long)looseBytes, (unsigned long long)packedBytes);
+        return 1;
+    }
+
+    double looseUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / order.size();
+    double packedUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / order.size();
+    printf("%zu clip reads, %llu bytes each way\n", order.size(), (unsigned long long)looseBytes);
+    printf("  loose files   %8.1f us/clip\n", looseUs);
+    printf("  archive       %8.1f us/clip  (%.2fx)\n", packedUs, looseUs / packedUs);
+    close(fd);
+    return 0;
+}
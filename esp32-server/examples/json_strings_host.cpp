@@ -0,0 +1,68 @@
+// Host build of the vendored ArduinoJson, timing documents with many
+// distinct strings: parse, then release every string again. Build it once
+// per string pool layout and compare:
+//
+//   g++ -O2 -I lib/ArduinoJson/src -DARDUINOJSON_STRING_POOL_INDEX=0 examples/json_strings_host.cpp -o json_list
+//   g++ -O2 -I lib/ArduinoJson/src -DARDUINOJSON_STRING_POOL_INDEX=1 examples/json_strings_host.cpp -o json_index
+//   ./json_list; ./json_index
+//
+// Each document is an array of n records, {"name": "item<i>", "tag": "t<i % 50>"}:
+// every name is a new string, every key and tag a repeat the pool has to
+// find. An array, because a big object would time its own duplicate-key
+// scan rather than the pool.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <chrono>
+#include <ArduinoJson.h>
+
+typedef std::chrono::steady_clock Clock;
+
+static std::string makeDocument(int n) {
+    std::string json = "[";
+    for (int i = 0; i < n; i++) {
+        if (i) json += ",";
+        json += "{\"name\":\"item" + std::to_string(i) + "\",\"tag\":\"t" + std::to_string(i % 50) + "\"}";
+    }
+    return json + "]";
+}
+
+int main() {
+    printf("string pool: %s\n", ARDUINOJSON_STRING_POOL_INDEX ? "hash index" : "linked list");
+    printf("%8s %12s %12s\n", "records", "parse ms", "release ms");
+    for (int n = 500; n <= 32000; n *= 2) {
+        std::string json = makeDocument(n);
+        JsonDocument doc;
+
+        Clock::time_point t0 = Clock::now();
+        DeserializationError err = deserializeJson(doc, json);
+        Clock::time_point t1 = Clock::now();
+        if (err) {
+            fprintf(stderr, "%d: %s\n", n, err.c_str());
+            return 1;
+        }
+
+        // Check before timing the release, which empties the document.
+        // Plain pointers: comparing the member proxies needs C++17.
+        JsonArray records = doc.as<JsonArray>();
+        const char* name = records[n - 1]["name"];
+        const char* tag = records[n - 1]["tag"];
+        if (records.size() != (size_t)n || !name || !tag
+            || strcmp(name, ("item" + std::to_string(n - 1)).c_str()) != 0
+            || strcmp(tag, ("t" + std::to_string((n - 1) % 50)).c_str()) != 0) {
+            fprintf(stderr, "%d: document doesn't match its input\n", n);
+            return 1;
+        }
+
+        // Drops each record's strings through the pool, oldest first
+        Clock::time_point t2 = Clock::now();
+        for (int i = 0; i < n; i++) records.remove(0);
+        Clock::time_point t3 = Clock::now();
+
+        printf("%8d %12.2f %12.2f\n", n,
+               std::chrono::duration<double, std::milli>(t1 - t0).count(),
+               std::chrono::duration<double, std::milli>(t3 - t2).count());
+    }
+    return 0;
+}
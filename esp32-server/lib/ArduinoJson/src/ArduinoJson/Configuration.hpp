@@ -145,6 +145,19 @@
 #  endif
 #endif
 
+// Index the string pool with an open-addressing hash table, so that
+// deduplicating and releasing a string costs O(1) on average instead of a
+// scan of every string in the document.
+// Costs 4 bytes per string, plus the table (one pointer per slot, kept at
+// most 75% full).
+#ifndef ARDUINOJSON_STRING_POOL_INDEX
+#  if ARDUINOJSON_SIZEOF_POINTER <= 2
+#    define ARDUINOJSON_STRING_POOL_INDEX 0  // keep 8-bit archs lean
+#  else
+#    define ARDUINOJSON_STRING_POOL_INDEX 1
+#  endif
+#endif
+
 #ifdef ARDUINO
 
 // Enable support for Arduino's String class
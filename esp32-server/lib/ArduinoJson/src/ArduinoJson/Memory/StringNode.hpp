@@ -22,6 +22,10 @@ struct StringNode {
   using length_type = uint_t<ARDUINOJSON_STRING_LENGTH_SIZE * 8>;
 
   struct StringNode* next;
+#if ARDUINOJSON_STRING_POOL_INDEX
+  // Cached by StringPool, so that lookups and rehashing don't rescan data
+  uint32_t hash;
+#endif
   references_type references;
   length_type length;
   char data[1];
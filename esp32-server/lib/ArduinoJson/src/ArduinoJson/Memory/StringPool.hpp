@@ -0,0 +1,246 @@
+// ArduinoJson - https://arduinojson.org
+// Copyright © 2014-2025, Benoit BLANCHON
+// MIT License
+
+#pragma once
+
+#include <ArduinoJson/Memory/Allocator.hpp>
+#include <ArduinoJson/Memory/StringNode.hpp>
+#include <ArduinoJson/Polyfills/assert.hpp>
+#include <ArduinoJson/Polyfills/utility.hpp>
+#include <ArduinoJson/Strings/StringAdapters.hpp>
+
+#include <stddef.h>  // offsetof
+
+ARDUINOJSON_BEGIN_PRIVATE_NAMESPACE
+
+#if ARDUINOJSON_STRING_POOL_INDEX
+// FNV-1a
+template <typename TAdaptedString>
+uint32_t stringHash(const TAdaptedString& str) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < str.size(); i++) {
+    hash ^= uint8_t(str[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+#endif
+
+// With ARDUINOJSON_STRING_POOL_INDEX, the strings live in an open-addressing
+// table (linear probing, backward-shift deletion) keyed by the hash cached in
+// each node. The linked list only holds the strings that couldn't be indexed
+// because the table failed to grow.
+class StringPool {
+ public:
+  StringPool() = default;
+  StringPool(const StringPool&) = delete;
+  void operator=(StringPool&& src) = delete;
+
+  ~StringPool() {
+    ARDUINOJSON_ASSERT(strings_ == nullptr);
+#if ARDUINOJSON_STRING_POOL_INDEX
+    ARDUINOJSON_ASSERT(index_ == nullptr);
+#endif
+  }
+
+  friend void swap(StringPool& a, StringPool& b) {
+    swap_(a.strings_, b.strings_);
+#if ARDUINOJSON_STRING_POOL_INDEX
+    swap_(a.index_, b.index_);
+    swap_(a.capacity_, b.capacity_);
+    swap_(a.count_, b.count_);
+#endif
+  }
+
+  void clear(Allocator* allocator) {
+#if ARDUINOJSON_STRING_POOL_INDEX
+    for (size_t i = 0; i < capacity_; i++) {
+      if (index_[i])
+        StringNode::destroy(index_[i], allocator);
+    }
+    if (index_)
+      allocator->deallocate(index_);
+    index_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+#endif
+    while (strings_) {
+      auto node = strings_;
+      strings_ = node->next;
+      StringNode::destroy(node, allocator);
+    }
+  }
+
+  size_t size() const {
+    size_t total = 0;
+#if ARDUINOJSON_STRING_POOL_INDEX
+    for (size_t i = 0; i < capacity_; i++) {
+      if (index_[i])
+        total += sizeofString(index_[i]->length);
+    }
+    total += capacity_ * sizeof(StringNode*);
+#endif
+    for (auto node = strings_; node; node = node->next)
+      total += sizeofString(node->length);
+    return total;
+  }
+
+  template <typename TAdaptedString>
+  StringNode* add(TAdaptedString str, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(str.isNull() == false);
+
+    auto node = get(str);
+    if (node) {
+      node->references++;
+      return node;
+    }
+
+    size_t n = str.size();
+
+    node = StringNode::create(n, allocator);
+    if (!node)
+      return nullptr;
+
+    stringGetChars(str, node->data, n);
+    node->data[n] = 0;  // force NUL terminator
+    add(node, allocator);
+    return node;
+  }
+
+  void add(StringNode* node, Allocator* allocator) {
+    ARDUINOJSON_ASSERT(node != nullptr);
+#if ARDUINOJSON_STRING_POOL_INDEX
+    node->hash = stringHash(adaptString(node->data, node->length));
+    if (reserve(count_ + 1, allocator)) {
+      index_[findFree(node->hash)] = node;
+      count_++;
+      return;
+    }
+#else
+    (void)allocator;
+#endif
+    node->next = strings_;
+    strings_ = node;
+  }
+
+  template <typename TAdaptedString>
+  StringNode* get(const TAdaptedString& str) const {
+#if ARDUINOJSON_STRING_POOL_INDEX
+    if (count_) {
+      auto hash = stringHash(str);
+      for (size_t i = hash & mask(); index_[i]; i = (i + 1) & mask()) {
+        auto node = index_[i];
+        if (node->hash == hash &&
+            stringEquals(str, adaptString(node->data, node->length)))
+          return node;
+      }
+    }
+#endif
+    for (auto node = strings_; node; node = node->next) {
+      if (stringEquals(str, adaptString(node->data, node->length)))
+        return node;
+    }
+    return nullptr;
+  }
+
+  void dereference(const char* s, Allocator* allocator) {
+#if ARDUINOJSON_STRING_POOL_INDEX
+    if (count_) {
+      // s is always the data of one of our nodes
+      auto target = reinterpret_cast<const StringNode*>(
+          s - offsetof(StringNode, data));
+      for (size_t i = target->hash & mask(); index_[i];
+           i = (i + 1) & mask()) {
+        auto node = index_[i];
+        if (node == target) {
+          if (--node->references == 0) {
+            unindex(i);
+            StringNode::destroy(node, allocator);
+          }
+          return;
+        }
+      }
+    }
+#endif
+    StringNode* prev = nullptr;
+    for (auto node = strings_; node; node = node->next) {
+      if (node->data == s) {
+        if (--node->references == 0) {
+          if (prev)
+            prev->next = node->next;
+          else
+            strings_ = node->next;
+          StringNode::destroy(node, allocator);
+        }
+        return;
+      }
+      prev = node;
+    }
+  }
+
+ private:
+#if ARDUINOJSON_STRING_POOL_INDEX
+  static const size_t initialCapacity = 8;  // power of two
+
+  size_t mask() const {
+    return capacity_ - 1;
+  }
+
+  size_t findFree(uint32_t hash) const {
+    size_t i = hash & mask();
+    while (index_[i])
+      i = (i + 1) & mask();
+    return i;
+  }
+
+  // Grows the table so that it can hold n strings at most 75% full.
+  // On failure, keeps the current table as long as one slot stays empty
+  // (probes stop on an empty slot).
+  bool reserve(size_t n, Allocator* allocator) {
+    if (n * 4 <= capacity_ * 3)
+      return true;
+    size_t newCapacity = initialCapacity;
+    if (capacity_)
+      newCapacity = capacity_ * 2;
+    auto newIndex = reinterpret_cast<StringNode**>(
+        allocator->allocate(newCapacity * sizeof(StringNode*)));
+    if (!newIndex)
+      return n < capacity_;
+    for (size_t i = 0; i < newCapacity; i++)
+      newIndex[i] = nullptr;
+    auto oldIndex = index_;
+    auto oldCapacity = capacity_;
+    index_ = newIndex;
+    capacity_ = newCapacity;
+    for (size_t i = 0; i < oldCapacity; i++) {
+      if (oldIndex[i])
+        index_[findFree(oldIndex[i]->hash)] = oldIndex[i];
+    }
+    if (oldIndex)
+      allocator->deallocate(oldIndex);
+    return true;
+  }
+
+  // Empties slot i, moving back the entries that probed past it
+  void unindex(size_t i) {
+    for (size_t j = (i + 1) & mask(); index_[j]; j = (j + 1) & mask()) {
+      size_t home = index_[j]->hash & mask();
+      if (((j - home) & mask()) >= ((j - i) & mask())) {
+        index_[i] = index_[j];
+        i = j;
+      }
+    }
+    index_[i] = nullptr;
+    count_--;
+  }
+
+  StringNode** index_ = nullptr;
+  size_t capacity_ = 0;
+  size_t count_ = 0;
+#endif
+
+  StringNode* strings_ = nullptr;
+};
+
+ARDUINOJSON_END_PRIVATE_NAMESPACE
@@ -15,7 +15,8 @@
         ARDUINOJSON_VERSION_MACRO,                                    \
         ARDUINOJSON_BIN2ALPHA(ARDUINOJSON_ENABLE_PROGMEM,             \
                               ARDUINOJSON_USE_LONG_LONG,              \
-                              ARDUINOJSON_USE_DOUBLE, 1),             \
+                              ARDUINOJSON_USE_DOUBLE,                 \
+                              ARDUINOJSON_STRING_POOL_INDEX),         \
         ARDUINOJSON_BIN2ALPHA(                                        \
             ARDUINOJSON_ENABLE_NAN, ARDUINOJSON_ENABLE_INFINITY,      \
             ARDUINOJSON_ENABLE_COMMENTS, ARDUINOJSON_DECODE_UNICODE), \
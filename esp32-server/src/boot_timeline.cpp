@@ -0,0 +1,37 @@
+#include "boot_timeline.h"
+#include <freertos/FreeRTOS.h>
+
+struct BootMark {
+    const char* label;
+    uint32_t us;
+};
+
+static BootMark marks[BOOT_MARKS_MAX];
+static uint8_t markCount = 0;
+static portMUX_TYPE markLock = portMUX_INITIALIZER_UNLOCKED;
+
+void bootMark(const char* label) {
+    uint32_t now = micros();
+    portENTER_CRITICAL(&markLock);
+    if (markCount < BOOT_MARKS_MAX) {
+        marks[markCount].label = label;
+        marks[markCount].us = now;
+        markCount++;
+    }
+    portEXIT_CRITICAL(&markLock);
+}
+
+void bootTimelineToJson(JsonDocument& doc) {
+    JsonArray list = doc["timeline"].to<JsonArray>();
+    portENTER_CRITICAL(&markLock);
+    uint8_t n = markCount;
+    BootMark copy[BOOT_MARKS_MAX];
+    memcpy(copy, marks, sizeof(BootMark) * n);
+    portEXIT_CRITICAL(&markLock);
+
+    for (uint8_t i = 0; i < n; i++) {
+        JsonObject o = list.add<JsonObject>();
+        o["stage"] = copy[i].label;
+        o["us"] = copy[i].us;
+    }
+}
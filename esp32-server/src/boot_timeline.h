@@ -0,0 +1,15 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Timestamped boot stages (micros() since power-on), served by GET /boot.
+// Safe to call from any task; labels must be string literals.
+
+#define BOOT_MARKS_MAX 16
+
+void bootMark(const char* label);
+void bootTimelineToJson(JsonDocument& doc);
+
+#endif
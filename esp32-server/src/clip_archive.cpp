@@ -0,0 +1,62 @@
+#include "clip_archive.h"
+#include <string.h>
+
+static uint16_t getLE16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t getLE32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool ClipArchive::fail(const char* msg) {
+    error_ = msg;
+    src_ = NULL;
+    return false;
+}
+
+bool ClipArchive::open(ClipSource* src) {
+    src_ = src;
+    error_ = "";
+    uint8_t h[CLIP_HEADER_SIZE];
+    if (!src->readAt(0, h, sizeof(h))) return fail("short header");
+    if (memcmp(h, CLIP_ARCHIVE_MAGIC, 4) != 0) return fail("not a clip archive");
+    clips_ = getLE16(h + 4);
+    categories_ = h[6];
+    uint32_t dataOffset = getLE32(h + 8);
+    uint32_t indexEnd = CLIP_HEADER_SIZE + (uint32_t)categories_ * CLIP_CATEGORY_SIZE + (uint32_t)clips_ * CLIP_ENTRY_SIZE;
+    if (dataOffset != indexEnd || dataOffset > src->size()) return fail("bad index size");
+    return true;
+}
+
+bool ClipArchive::category(uint8_t c, char out[CLIP_CATEGORY_SIZE + 1]) {
+    if (!src_ || c >= categories_) return false;
+    if (!src_->readAt(CLIP_HEADER_SIZE + (uint32_t)c * CLIP_CATEGORY_SIZE, out, CLIP_CATEGORY_SIZE)) return false;
+    out[CLIP_CATEGORY_SIZE] = '\0';
+    return true;
+}
+
+bool ClipArchive::entry(uint16_t i, ClipEntry& out) {
+    if (!src_ || i >= clips_) return false;
+    uint8_t b[CLIP_ENTRY_SIZE];
+    uint32_t at = CLIP_HEADER_SIZE + (uint32_t)categories_ * CLIP_CATEGORY_SIZE + (uint32_t)i * CLIP_ENTRY_SIZE;
+    if (!src_->readAt(at, b, sizeof(b))) return false;
+    out.id = getLE16(b);
+    out.category = b[2];
+    out.codec = b[3];
+    out.offset = getLE32(b + 4);
+    out.length = getLE32(b + 8);
+    out.durationMs = getLE32(b + 12);
+    memcpy(out.name, b + 16, CLIP_NAME_MAX);
+    out.name[CLIP_NAME_MAX] = '\0';
+    // A truncated or hand-edited archive must not send reads past the end
+    if (out.id != i || out.category >= categories_) return fail("bad index entry");
+    if (out.offset > src_->size() || out.length > src_->size() - out.offset) return fail("clip past end of archive");
+    return true;
+}
+
+size_t ClipArchive::read(const ClipEntry& e, uint32_t pos, void* buf, size_t len) {
+    if (!src_ || pos >= e.length) return 0;
+    if (len > e.length - pos) len = e.length - pos;
+    return src_->readAt(e.offset + pos, buf, len) ? len : 0;
+}
@@ -0,0 +1,84 @@
+#ifndef CLIP_ARCHIVE_H
+#define CLIP_ARCHIVE_H
+
+// Packed clip archive (/clips.sra, built by scripts/pack_clips.py): every
+// clip back to back behind one index. The firmware keeps that one file
+// open and serves clips with positioned reads, instead of walking the
+// category directories at boot and opening a file per request; LittleFS
+// also stops rounding every clip up to a whole block.
+//
+// Format (little-endian):
+//   header      "SRA1"  u16 clipCount  u8 categoryCount  u8 reserved  u32 dataOffset
+//   categories  categoryCount x char[16], NUL padded
+//   index       clipCount x 48 bytes:
+//               u16 id  u8 category  u8 codec  u32 offset  u32 length
+//               u32 durationMs  char name[32] (NUL padded)
+//   data        the clips; offsets are from the start of the file
+// id is the clip's position in the index (checked when reading it).
+//
+// No Arduino dependencies, so the same reader runs on the host against a
+// plain file (see examples/archive_host.cpp).
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CLIP_ARCHIVE_MAGIC     "SRA1"
+#define CLIP_HEADER_SIZE       12
+#define CLIP_CATEGORY_SIZE     16
+#define CLIP_ENTRY_SIZE        48
+#define CLIP_NAME_MAX          32
+
+enum ClipCodec : uint8_t {
+    CLIP_CODEC_MP3 = 1,
+    CLIP_CODEC_WAV = 2
+};
+
+struct ClipEntry {
+    uint16_t id;
+    uint8_t category;
+    uint8_t codec;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t durationMs;
+    char name[CLIP_NAME_MAX + 1];   // "collision_1.mp3"
+};
+
+// Where the archive's bytes come from: a LittleFS File on the board, a
+// file descriptor on the host. One handle for the archive's lifetime.
+class ClipSource {
+public:
+    virtual ~ClipSource() {}
+    virtual uint32_t size() = 0;
+    // Exactly len bytes at offset, or false
+    virtual bool readAt(uint32_t offset, void* buf, size_t len) = 0;
+};
+
+class ClipArchive {
+public:
+    ClipArchive() : src_(NULL), clips_(0), categories_(0), error_("") {}
+
+    // Checks the header; entries are read on demand
+    bool open(ClipSource* src);
+    void close() { src_ = NULL; }
+    bool isOpen() const { return src_ != NULL; }
+
+    uint16_t clipCount() const { return clips_; }
+    uint8_t categoryCount() const { return categories_; }
+    bool category(uint8_t c, char out[CLIP_CATEGORY_SIZE + 1]);
+    bool entry(uint16_t i, ClipEntry& out);
+
+    // Up to len bytes at pos within a clip; returns how many (0 past the end)
+    size_t read(const ClipEntry& e, uint32_t pos, void* buf, size_t len);
+
+    const char* error() const { return error_; }
+
+private:
+    bool fail(const char* msg);
+
+    ClipSource* src_;
+    uint16_t clips_;
+    uint8_t categories_;
+    const char* error_;
+};
+
+#endif
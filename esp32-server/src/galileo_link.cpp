@@ -0,0 +1,245 @@
+#include "galileo_link.h"
+#include "loop_wait.h"
+
+// The UART driver fills its own FIFO/ring from the RX interrupt. onReceive()
+// fires from the driver's event task whenever a burst lands (FIFO threshold or
+// RX timeout), and we move the bytes into a small single-producer /
+// single-consumer ring so loop() never touches the driver or waits on it.
+// Bytes are then reassembled into frames (galileo_nav/link_protocol.h).
+
+#define LINK_RING_SIZE  256   // must be a power of two
+
+static HardwareSerial& linkPort = Serial2;
+
+static uint8_t ring[LINK_RING_SIZE];
+static volatile uint16_t ringHead = 0;   // written by the UART callback only
+static volatile uint16_t ringTail = 0;   // written by pollGalileoLink() only
+
+static LinkParser parser;
+static int lastEventSeq = -1;            // for dropping retransmitted duplicates
+static unsigned long lastEventAtMs = 0;
+
+static NavEventHandler eventHandler = NULL;
+static GalileoLinkStats stats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static volatile unsigned long ringOverflows = 0;
+
+static LinkTelemetry telemetry;
+static bool haveTelemetryBase = false;  // telemetry.distanceCm valid for deltas
+static uint8_t lastTelemetrySeq = 0;
+static unsigned long telemetryAtMs = 0;
+static NavEvent lastEvent = NAV_NONE;
+
+static LinkCommand cmdQueue[GALILEO_CMD_QUEUE];
+static uint8_t cmdHead = 0, cmdCount = 0;
+static uint8_t cmdSeq = 0;
+static bool cmdInFlight = false;
+static uint8_t cmdAttempts = 0;
+static unsigned long cmdSentAt = 0;
+
+// PAUSE_WANDER is state rather than a one-off: it is queued again until an
+// ACK confirms the Galileo has what we want (it boots wandering)
+static bool wantPaused = false;
+static bool pauseSynced = true;
+static bool pauseQueued = false;         // at most one in cmdQueue
+
+static void onLinkReceive() {
+    uint16_t head = ringHead;
+    while (linkPort.available()) {
+        int c = linkPort.read();
+        if (c < 0) break;
+        uint16_t next = (head + 1) & (LINK_RING_SIZE - 1);
+        if (next == ringTail) {
+            ringOverflows++;  // consumer is behind; drop the byte
+            continue;
+        }
+        ring[head] = (uint8_t)c;
+        head = next;
+    }
+    ringHead = head;
+    wakeLoop();
+}
+
+void setupGalileoLink(NavEventHandler handler) {
+    eventHandler = handler;
+    linkPort.setRxBufferSize(512);
+    linkPort.begin(GALILEO_BAUD, SERIAL_8N1, GALILEO_RX_PIN, GALILEO_TX_PIN);
+    linkPort.onReceive(onLinkReceive);
+    Serial.println("GALILEO LINK: UART2 @ " + String(GALILEO_BAUD));
+}
+
+static void sendAck(uint8_t seq) {
+    uint8_t frame[LINK_FRAME_MAX];
+    uint8_t n = linkEncode(frame, LINK_ACK, seq, NULL, 0);
+    linkPort.write(frame, n);  // 5 bytes, fits the TX FIFO: doesn't block
+}
+
+static void popCommand(bool acked) {
+    const LinkCommand& c = cmdQueue[cmdHead];
+    if (c.id == CMD_PAUSE_WANDER) {
+        pauseQueued = false;
+        if (acked && (c.value != 0) == wantPaused) pauseSynced = true;
+    }
+    cmdHead = (cmdHead + 1) % GALILEO_CMD_QUEUE;
+    cmdCount--;
+    cmdInFlight = false;
+}
+
+static void handleFrame(const LinkFrame& f) {
+    stats.frames++;
+    stats.lastRxMs = millis();
+
+    switch (f.type) {
+        case LINK_TELEMETRY: {
+            // A SEQ gap means a frame (maybe the last keyframe) was lost:
+            // deltas are meaningless until the next absolute distance
+            if (telemetryAtMs != 0 && f.seq != (uint8_t)(lastTelemetrySeq + 1)) {
+                stats.telemetryLost += (uint8_t)(f.seq - lastTelemetrySeq - 1);
+                haveTelemetryBase = false;
+            }
+            lastTelemetrySeq = f.seq;
+            if (linkDecodeTelemetry(f.payload, f.len, telemetry, haveTelemetryBase)) {
+                haveTelemetryBase = true;
+                telemetryAtMs = stats.lastRxMs;
+                stats.telemetry++;
+            } else if (telemetryAtMs == 0) {
+                telemetryAtMs = stats.lastRxMs;  // seen the stream, still waiting for a keyframe
+            }
+            break;
+        }
+
+        case LINK_EVENT: {
+            // Always ACK, even a duplicate: the first ACK may be what got lost
+            sendAck(f.seq);
+            // Same SEQ again shortly after = a retry. Outside the window it's
+            // a rebooted Galileo whose counter came round to the same value.
+            if (f.seq == lastEventSeq && stats.lastRxMs - lastEventAtMs < LINK_DUP_WINDOW_MS) {
+                stats.duplicates++;
+                break;
+            }
+            lastEventSeq = f.seq;
+            lastEventAtMs = stats.lastRxMs;
+            NavEvent ev = f.len >= 1 && f.payload[0] < NAV_EVENT_COUNT ? (NavEvent)f.payload[0] : NAV_NONE;
+            if (ev == NAV_NONE) {
+                stats.unknown++;
+                break;
+            }
+            Serial.print("GALILEO: ");
+            Serial.println(navEventName(ev));
+            lastEvent = ev;
+            if (ev == NAV_BOOT && wantPaused) pauseSynced = false;  // rebooted wandering
+            if (eventHandler) eventHandler(ev);
+            break;
+        }
+
+        case LINK_ACK:
+            if (cmdInFlight && f.seq == cmdSeq) {
+                stats.commandsAcked++;
+                popCommand(true);
+            }
+            break;
+
+        default:
+            stats.unknown++;
+            break;
+    }
+}
+
+static void pushCommand(const LinkCommand& cmd) {
+    cmdQueue[(cmdHead + cmdCount) % GALILEO_CMD_QUEUE] = cmd;
+    cmdCount++;
+}
+
+// Head of the command queue: first send, or a retry once the ACK is overdue
+static void serviceCommands() {
+    if (!pauseSynced && !pauseQueued && cmdCount < GALILEO_CMD_QUEUE) {
+        LinkCommand pause = { CMD_PAUSE_WANDER, 0, (uint16_t)wantPaused };
+        pushCommand(pause);
+        pauseQueued = true;
+    }
+    if (cmdCount == 0) return;
+    unsigned long now = millis();
+    if (cmdInFlight) {
+        if (now - cmdSentAt < LINK_ACK_TIMEOUT_MS) return;
+        if (cmdAttempts > LINK_MAX_RETRIES) {
+            Serial.println("GALILEO: COMMAND NOT ACKED");
+            stats.commandsFailed++;
+            popCommand(false);
+            if (cmdCount == 0) return;
+        }
+    }
+    if (!cmdInFlight) {
+        cmdInFlight = true;
+        cmdSeq++;
+        cmdAttempts = 0;
+    }
+    uint8_t payload[LINK_COMMAND_LEN];
+    uint8_t frame[LINK_FRAME_MAX];
+    uint8_t n = linkEncode(frame, LINK_COMMAND, cmdSeq, payload, linkEncodeCommand(payload, cmdQueue[cmdHead]));
+    linkPort.write(frame, n);  // 9 bytes, fits the TX FIFO
+    cmdAttempts++;
+    cmdSentAt = now;
+}
+
+bool galileoSendCommand(const LinkCommand& cmd) {
+    if (cmd.id == CMD_PAUSE_WANDER) {
+        // Queued by serviceCommands(), now or as soon as there's room
+        wantPaused = cmd.value != 0;
+        pauseSynced = false;
+    } else if (cmdCount >= GALILEO_CMD_QUEUE) {
+        stats.commandsFailed++;
+        return false;
+    } else {
+        pushCommand(cmd);
+    }
+    serviceCommands();  // idle link: out right away
+    return true;
+}
+
+bool galileoCommandPending() {
+    return cmdCount > 0 || !pauseSynced;
+}
+
+bool galileoWanderPauseSynced() {
+    return pauseSynced;
+}
+
+void pollGalileoLink() {
+    uint16_t tail = ringTail;
+    uint16_t head = ringHead;
+    while (tail != head) {
+        uint8_t c = ring[tail];
+        tail = (tail + 1) & (LINK_RING_SIZE - 1);
+        ringTail = tail;  // free the slot before the handler runs (it may be slow)
+        stats.rxBytes++;
+        parser.push(c);
+        LinkFrame f;
+        while (parser.next(f)) handleFrame(f);
+    }
+    serviceCommands();
+}
+
+static bool telemetryFresh() {
+    return haveTelemetryBase && millis() - telemetryAtMs <= GALILEO_DIST_STALE_MS;
+}
+
+long galileoDistanceCm() {
+    if (!telemetryFresh() || telemetry.distanceCm == TELEMETRY_NO_DISTANCE) return -1;
+    return telemetry.distanceCm;
+}
+
+bool galileoTelemetry(LinkTelemetry& out) {
+    if (!telemetryFresh()) return false;
+    out = telemetry;
+    return true;
+}
+
+const char* galileoLastEvent() {
+    return navEventName(lastEvent);
+}
+
+GalileoLinkStats galileoLinkStats() {
+    GalileoLinkStats s = stats;
+    s.overflows += ringOverflows;
+    s.crcErrors = parser.crcErrors();
+    return s;
+}
@@ -0,0 +1,59 @@
+#ifndef GALILEO_LINK_H
+#define GALILEO_LINK_H
+
+#include <Arduino.h>
+#include "galileo_nav/events.h"
+#include "galileo_nav/link_protocol.h"
+
+// UART link to the Galileo/UNO navigation board (layer-c-galileo).
+// Wiring: Galileo TX -> GPIO16 (RX2), Galileo RX <- GPIO17 (TX2), common GND.
+#define GALILEO_RX_PIN   16
+#define GALILEO_TX_PIN   17
+#define GALILEO_BAUD     9600
+
+// Telemetry older than this is reported as unknown (distance -1)
+#define GALILEO_DIST_STALE_MS  2000
+
+#define GALILEO_CMD_QUEUE      4     // commands waiting behind the one in flight
+
+// Called from pollGalileoLink() (loop context, never from the ISR)
+// once per delivered EVENT frame (retransmissions are ACKed and dropped).
+typedef void (*NavEventHandler)(NavEvent ev);
+
+struct GalileoLinkStats {
+    unsigned long rxBytes;     // bytes moved out of the UART driver
+    unsigned long frames;      // valid frames (CRC ok)
+    unsigned long overflows;   // ring buffer full
+    unsigned long crcErrors;   // corrupted frames dropped by the parser
+    unsigned long duplicates;  // retransmitted events already delivered
+    unsigned long unknown;     // frames with an unknown type or event id
+    unsigned long telemetry;   // telemetry frames decoded
+    unsigned long telemetryLost;  // telemetry SEQ gaps
+    unsigned long commandsAcked;  // commands the Galileo confirmed
+    unsigned long commandsFailed; // no ACK after LINK_MAX_RETRIES, or queue full
+    unsigned long lastRxMs;    // millis() of the last valid frame (0 = never)
+};
+
+void setupGalileoLink(NavEventHandler handler);
+
+// Non-blocking: parses whatever the UART callback has queued and returns.
+void pollGalileoLink();
+
+// Distance from the latest telemetry frame (cm), -1 if none or stale.
+long galileoDistanceCm();
+// Latest telemetry (bumpers, motion, drive state, overruns); false if stale
+bool galileoTelemetry(LinkTelemetry& out);
+const char* galileoLastEvent();
+
+// Queues a command for the Galileo (link_protocol.h). Sent in order, one
+// at a time, resent every LINK_ACK_TIMEOUT_MS until ACKed. False if the
+// queue is full. PAUSE_WANDER is never refused: the latest one is kept and
+// sent again (also after a Galileo reboot) until it is ACKed.
+bool galileoSendCommand(const LinkCommand& cmd);
+// The Galileo has ACKed the latest PAUSE_WANDER
+bool galileoWanderPauseSynced();
+// A command is waiting for its ACK (loop() shouldn't sleep past the retry)
+bool galileoCommandPending();
+GalileoLinkStats galileoLinkStats();
+
+#endif
@@ -0,0 +1,84 @@
+#include "latency_trace.h"
+
+static TraceRecord traces[TRACE_SLOTS];
+static uint8_t nextSlot = 0;
+static int8_t activeSlot = -1;     // trace of the request being handled
+static int8_t deliverySlot = -1;   // trace waiting for GET /event
+
+static const char* STAGE_NAMES[TRACE_STAGES] = { "parse", "decision", "gpio", "delivered" };
+
+void traceBegin(const char* source, const char* id, double clientTs, uint32_t parseUs) {
+    activeSlot = -1;
+    if (id == NULL || id[0] == '\0') return;
+
+    TraceRecord& t = traces[nextSlot];
+    if (deliverySlot == nextSlot) deliverySlot = -1;  // overwriting a stale pending record
+    memset(&t, 0, sizeof(t));
+    strncpy(t.id, id, TRACE_ID_MAX - 1);
+    strncpy(t.source, source, sizeof(t.source) - 1);
+    t.clientTs = clientTs;
+    t.at[TRACE_PARSE] = parseUs ? parseUs : 1;
+    activeSlot = nextSlot;
+    nextSlot = (nextSlot + 1) % TRACE_SLOTS;
+}
+
+void traceMark(TraceStage stage) {
+    if (activeSlot < 0) return;
+    uint32_t& slot = traces[activeSlot].at[stage];
+    if (slot == 0) slot = micros();
+}
+
+void traceHoldForDelivery() {
+    deliverySlot = activeSlot;
+}
+
+void traceDelivered() {
+    if (deliverySlot < 0) return;
+    uint32_t& slot = traces[deliverySlot].at[TRACE_DELIVERED];
+    if (slot == 0) slot = micros();
+    deliverySlot = -1;
+}
+
+const char* tracePendingDeliveryId() {
+    return deliverySlot < 0 ? "" : traces[deliverySlot].id;
+}
+
+void traceEnd() {
+    activeSlot = -1;
+}
+
+// Oldest first. Each stage is reported as microseconds since the previous
+// stage reached (parse for the first), plus the average per stage over all
+// records that reached it, so the dominant stage stands out without
+// post-processing.
+void traceToJson(JsonDocument& doc) {
+    JsonArray list = doc["traces"].to<JsonArray>();
+    uint32_t sum[TRACE_STAGES] = {0};
+    uint16_t count[TRACE_STAGES] = {0};
+
+    for (uint8_t i = 0; i < TRACE_SLOTS; i++) {
+        const TraceRecord& t = traces[(nextSlot + i) % TRACE_SLOTS];
+        if (t.at[TRACE_PARSE] == 0) continue;
+
+        JsonObject o = list.add<JsonObject>();
+        o["id"] = t.id;
+        o["source"] = t.source;
+        if (t.clientTs >= 0) o["clientTs"] = t.clientTs;
+        o["parseAtUs"] = t.at[TRACE_PARSE];
+
+        uint32_t prev = t.at[TRACE_PARSE];
+        for (uint8_t s = TRACE_DECISION; s < TRACE_STAGES; s++) {
+            if (t.at[s] == 0) { o[STAGE_NAMES[s]] = nullptr; continue; }
+            uint32_t d = t.at[s] - prev;
+            o[STAGE_NAMES[s]] = d;
+            sum[s] += d;
+            count[s]++;
+            prev = t.at[s];
+        }
+    }
+
+    JsonObject avg = doc["avgUs"].to<JsonObject>();
+    for (uint8_t s = TRACE_DECISION; s < TRACE_STAGES; s++) {
+        if (count[s]) avg[STAGE_NAMES[s]] = sum[s] / count[s];
+    }
+}
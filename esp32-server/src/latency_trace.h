@@ -0,0 +1,49 @@
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Per-request latency records for /detect, /event and /move.
+// A trace starts when a request carries a `trace` id and is stamped at each
+// stage on its way to the wheels and the voice client. Timestamps are
+// micros() on the ESP32; the client timestamp is echoed back untouched so the
+// caller can line it up with its own clock.
+
+#define TRACE_SLOTS   16
+#define TRACE_ID_MAX  16
+
+enum TraceStage {
+    TRACE_PARSE = 0,     // handler entered, args parsed
+    TRACE_DECISION,      // performManeuver()/joystick decided what to do
+    TRACE_GPIO,          // first motor pin write
+    TRACE_DELIVERED,     // event handed to the voice client (GET /event)
+    TRACE_STAGES
+};
+
+struct TraceRecord {
+    char id[TRACE_ID_MAX];
+    char source[8];               // "detect", "event", "move"
+    double clientTs;              // as sent by the client (-1 = not given)
+    uint32_t at[TRACE_STAGES];    // micros(), 0 = stage not reached
+};
+
+// Starts a trace if the current request has a `trace` arg/field.
+// parseUs is the micros() taken at handler entry.
+void traceBegin(const char* source, const char* id, double clientTs, uint32_t parseUs);
+
+// Stamps a stage on the active trace (first stamp wins).
+void traceMark(TraceStage stage);
+
+// The active trace produced a voice event; stamp TRACE_DELIVERED on it when
+// the voice client picks the event up.
+void traceHoldForDelivery();
+void traceDelivered();
+const char* tracePendingDeliveryId();
+
+// Request is done (wheels may still be turning, delivery may be pending).
+void traceEnd();
+
+void traceToJson(JsonDocument& doc);
+
+#endif
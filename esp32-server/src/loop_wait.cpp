@@ -0,0 +1,120 @@
+#include "loop_wait.h"
+#include <lwip/sockets.h>
+#include <fcntl.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#include <esp_idf_version.h>
+#endif
+
+#define METRICS_WINDOW_US  1000000
+
+static int wakeSock = -1;
+static struct sockaddr_in wakeAddr;
+static volatile bool wakePending = false;
+
+// Current window
+static uint32_t windowStartUs = 0;
+static uint32_t windowWaitUs = 0;
+static uint32_t windowWakeups = 0;
+// Last complete window
+static float busyPct = 100.0f;
+static uint32_t wakeupsPerSec = 0;
+
+void setupLoopWait() {
+    // Published to wakeLoop() only once it is fully set up: the UART and
+    // storage tasks may already be calling it.
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    memset(&wakeAddr, 0, sizeof(wakeAddr));
+    wakeAddr.sin_family = AF_INET;
+    wakeAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    wakeAddr.sin_port = 0;  // let lwip pick, read it back below
+    socklen_t len = sizeof(wakeAddr);
+    if (sock < 0 ||
+        bind(sock, (struct sockaddr*)&wakeAddr, sizeof(wakeAddr)) != 0 ||
+        getsockname(sock, (struct sockaddr*)&wakeAddr, &len) != 0) {
+        Serial.println("LOOP WAIT: no wake socket, falling back to polling");
+        if (sock >= 0) close(sock);
+    } else {
+        fcntl(sock, F_SETFL, O_NONBLOCK);
+        wakeSock = sock;
+    }
+
+#if CONFIG_PM_ENABLE
+    // Let the CPU clock down while loop() is blocked. Light sleep stays off:
+    // the soft AP has to keep beaconing.
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm = {};
+#else
+    esp_pm_config_esp32s3_t pm = {};
+#endif
+    pm.max_freq_mhz = 240;
+    pm.min_freq_mhz = 80;
+    pm.light_sleep_enable = false;
+    esp_pm_configure(&pm);
+#endif
+
+    windowStartUs = micros();
+}
+
+void wakeLoop() {
+    if (wakeSock < 0 || wakePending) return;
+    wakePending = true;
+    uint8_t b = 1;
+    sendto(wakeSock, &b, 1, 0, (struct sockaddr*)&wakeAddr, sizeof(wakeAddr));
+}
+
+static void closeWindow(uint32_t now) {
+    uint32_t elapsed = now - windowStartUs;
+    if (elapsed < METRICS_WINDOW_US) return;
+    busyPct = 100.0f * (1.0f - (float)windowWaitUs / (float)elapsed);
+    if (busyPct < 0) busyPct = 0;
+    wakeupsPerSec = (uint64_t)windowWakeups * 1000000ULL / elapsed;
+    windowStartUs = now;
+    windowWaitUs = 0;
+    windowWakeups = 0;
+}
+
+void waitForWork(uint32_t maxMs) {
+    uint32_t start = micros();
+
+    if (wakeSock < 0) {
+        delay(1);  // no wake socket: behave like the old loop
+    } else {
+        // Every live socket in lwip's range: the listener (new connections)
+        // and any accepted client (request bytes / close).
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        int maxFd = -1;
+        for (int fd = LWIP_SOCKET_OFFSET; fd < LWIP_SOCKET_OFFSET + CONFIG_LWIP_MAX_SOCKETS; fd++) {
+            if (fcntl(fd, F_GETFL, 0) < 0) continue;  // not open
+            FD_SET(fd, &readSet);
+            if (fd > maxFd) maxFd = fd;
+        }
+
+        struct timeval tv;
+        tv.tv_sec = maxMs / 1000;
+        tv.tv_usec = (maxMs % 1000) * 1000;
+        int ready = select(maxFd + 1, &readSet, NULL, NULL, &tv);
+
+        if (ready > 0 && FD_ISSET(wakeSock, &readSet)) {
+            // Drain, then re-arm. Producers queue their work before calling
+            // wakeLoop(), so a wake skipped in between is served by the loop
+            // pass that runs right after this returns.
+            uint8_t buf[8];
+            while (recv(wakeSock, buf, sizeof(buf), 0) > 0) {}
+            wakePending = false;
+        }
+    }
+
+    uint32_t now = micros();
+    windowWaitUs += now - start;
+    windowWakeups++;
+    closeWindow(now);
+}
+
+void loopMetricsToJson(JsonDocument& doc) {
+    JsonObject loop = doc["loop"].to<JsonObject>();
+    loop["busyPct"] = round(busyPct * 10) / 10.0;
+    loop["wakeupsPerSec"] = wakeupsPerSec;
+    loop["waitMode"] = wakeSock < 0 ? "poll" : "select";
+}
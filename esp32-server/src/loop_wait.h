@@ -0,0 +1,28 @@
+#ifndef LOOP_WAIT_H
+#define LOOP_WAIT_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Event-driven idle for loop(). Instead of delay(1) polling, loop() blocks in
+// lwip select() on every open socket (the HTTP listener and its clients) plus
+// a loopback "wake" socket that other tasks poke through wakeLoop(): the UART
+// callback, the maneuver control tick and the storage task. Nothing pending
+// means the loop task is blocked and the idle task (DFS / light sleep when
+// power management allows it) gets the CPU.
+
+#define LOOP_IDLE_WAIT_MS  1000   // housekeeping upper bound on a blocked wait
+
+// Call once WiFi (and so lwip) is up.
+void setupLoopWait();
+
+// Wake loop() from any task (not from an ISR). Cheap and coalesced.
+void wakeLoop();
+
+// Blocks until a socket is readable, wakeLoop() is called, or maxMs passes.
+void waitForWork(uint32_t maxMs);
+
+// Loop CPU-busy percentage and wakeups over the last 1 s window
+void loopMetricsToJson(JsonDocument& doc);
+
+#endif
@@ -5,6 +5,15 @@
 #include <WebServer.h>
 #include <ArduinoJson.h>
 #include <LittleFS.h>
+#include "galileo_link.h"
+#include "galileo_nav/fast_pin.h"
+#include "latency_trace.h"
+#include "boot_timeline.h"
+#include "storage.h"
+#include "rover_types.h"
+#include "maneuvers.h"
+#include "loop_wait.h"
+#include "ota_update.h"
 
 // =============================================================
 // CONFIGURATION
@@ -26,19 +35,30 @@ const char* AP_PASSWORD = "bazinga123";
 // =============================================================
 
 WebServer server(80);
-String lastEvent = ""; // For audio polling
+RoverEvent lastEvent = EVT_NONE;        // For audio polling
+char lastSayFile[ASSET_PATH_MAX] = "";  // File name when lastEvent == EVT_SAY
+int lastEventClip = -1;                 // Asset the voice page should play for it (-1 = its choice)
 
 // NEW: Split Modes
-String driveMode = "AUTO";   // Default: AUTO (Starts automatically)
-String voiceMode = "AUTO";   // Default: AUTO
+RoverMode driveMode = MODE_AUTO;   // Default: AUTO (Starts automatically)
+RoverMode voiceMode = MODE_AUTO;   // Default: AUTO
 
 // =============================================================
 // MOTOR FUNCTIONS (Full Speed / Bang-Bang)
 // =============================================================
 
 // Helper to update event state for Joystick feedback
-void setEvent(String evt) {
+void setEvent(RoverEvent evt) {
     lastEvent = evt;
+    lastEventClip = -1;
+}
+
+// All motor pin changes go through here (first write is the trace GPIO stage)
+void setMotorPins(uint8_t in1, uint8_t in2, uint8_t in3, uint8_t in4) {
+    traceMark(TRACE_GPIO);
+    // Per side: clear then set, so a reversal passes through coast, not brake
+    PinPair<IN1, IN2>::write(in1, in2);
+    PinPair<IN3, IN4>::write(in3, in4);
 }
 
 void setupMotors() {
@@ -55,76 +75,84 @@ void setupMotors() {
 }
 
 void stopMotors() {
-    digitalWrite(IN1, LOW);
-    digitalWrite(IN2, LOW);
-    digitalWrite(IN3, LOW);
-    digitalWrite(IN4, LOW);
+    setMotorPins(LOW, LOW, LOW, LOW);
     Serial.println("MOTORS: STOP");
     // setEvent("STOP"); // Optional: Audio for stop?
 }
 
 void moveForward() {
-    digitalWrite(IN1, HIGH);
-    digitalWrite(IN2, LOW);
-    digitalWrite(IN3, HIGH);
-    digitalWrite(IN4, LOW);
+    setMotorPins(HIGH, LOW, HIGH, LOW);
     Serial.println("MOTORS: FORWARD");
-    setEvent("MOVING_FORWARD");
+    setEvent(EVT_MOVING_FORWARD);
 }
 
 void moveBackward() {
-    digitalWrite(IN1, LOW);
-    digitalWrite(IN2, HIGH);
-    digitalWrite(IN3, LOW);
-    digitalWrite(IN4, HIGH);
+    setMotorPins(LOW, HIGH, LOW, HIGH);
     Serial.println("MOTORS: BACKWARD");
-    setEvent("MOVING_BACKWARD");
+    setEvent(EVT_MOVING_BACKWARD);
 }
 
 void turnLeft() {
-    digitalWrite(IN1, LOW);
-    digitalWrite(IN2, HIGH);
-    digitalWrite(IN3, HIGH);
-    digitalWrite(IN4, LOW);
+    setMotorPins(LOW, HIGH, HIGH, LOW);
     Serial.println("MOTORS: LEFT");
-    setEvent("TURNING_LEFT");
+    setEvent(EVT_TURNING_LEFT);
 }
 
 void turnRight() {
-    digitalWrite(IN1, HIGH);
-    digitalWrite(IN2, LOW);
-    digitalWrite(IN3, LOW);
-    digitalWrite(IN4, HIGH);
+    setMotorPins(HIGH, LOW, LOW, HIGH);
     Serial.println("MOTORS: RIGHT");
-    setEvent("TURNING_RIGHT");
+    setEvent(EVT_TURNING_RIGHT);
 }
 
 // Joystick Support (Mapped to Bang-Bang)
-String lastAction = "";
+enum JoyAction : uint8_t { JOY_NONE, JOY_STOP, JOY_FWD, JOY_BWD, JOY_LEFT, JOY_RIGHT };
+JoyAction lastAction = JOY_NONE;
 
 void moveMotorsLegacy(int x, int y) {
-    String currentAction = "";
+    traceMark(TRACE_DECISION);
+    if (maneuverRunning()) {
+        abortManeuver(); // Joystick overrides a running maneuver
+        lastAction = JOY_NONE;
+    }
 
     if (abs(x) < 20 && abs(y) < 20) { 
-        if(lastAction != "STOP") {
+        if(lastAction != JOY_STOP) {
             stopMotors(); 
-            lastAction = "STOP";
+            lastAction = JOY_STOP;
         }
         return; 
     }
     
     // Simple 4-way direction for joystick
     if (y > 30) { 
-        if(lastAction != "FWD") { moveForward(); lastAction = "FWD"; }
+        if(lastAction != JOY_FWD) { moveForward(); lastAction = JOY_FWD; }
     }
     else if (y < -30) { 
-        if(lastAction != "BWD") { moveBackward(); lastAction = "BWD"; }
+        if(lastAction != JOY_BWD) { moveBackward(); lastAction = JOY_BWD; }
     }
     else if (x < -30) { 
-        if(lastAction != "LEFT") { turnLeft(); lastAction = "LEFT"; }
+        if(lastAction != JOY_LEFT) { turnLeft(); lastAction = JOY_LEFT; }
     }
     else if (x > 30) { 
-        if(lastAction != "RIGHT") { turnRight(); lastAction = "RIGHT"; }
+        if(lastAction != JOY_RIGHT) { turnRight(); lastAction = JOY_RIGHT; }
+    }
+}
+
+// Maneuver interpreter -> motor functions
+void driveMotors(MotorCmd cmd) {
+    RoverEvent pending = lastEvent;
+    int pendingClip = lastEventClip;
+    switch (cmd) {
+        case MOTOR_FORWARD:  moveForward(); break;
+        case MOTOR_BACKWARD: moveBackward(); break;
+        case MOTOR_LEFT:     turnLeft(); break;
+        case MOTOR_RIGHT:    turnRight(); break;
+        default:             stopMotors(); break;
+    }
+    // The motion feedback mustn't replace a line the voice page hasn't fetched
+    if (pendingClip >= 0) {
+        lastEvent = pending;
+        lastEventClip = pendingClip;
     }
 }
 
@@ -132,78 +160,142 @@ void moveMotorsLegacy(int x, int y) {
 // EVENT LOGIC (Maneuvers)
 // =============================================================
 
-unsigned long lastAudioTime = 0;
-const int AUDIO_COOLDOWN = 5000; // 5 Seconds
+// The rover picks the line itself, so it knows how long it runs (precomputed
+// in audio_map.json / the archive index) and can time the cooldown and the
+// maneuver to it instead of a fixed 5 s.
+#define AUDIO_LEAD_MS     500    // voice page polls /event every 500 ms
+#define AUDIO_GAP_MS      1000   // quiet time after a line before auto-detect talks again
+#define AUDIO_UNKNOWN_MS  3500   // no clip / no metadata (TTS): the old 5 s cooldown overall
+
+unsigned long audioBusyUntil = 0;       // millis() when the current line (plus gap) ends
+uint8_t lastClip[ASSET_CAT_MAX];        // per category, asset + 1, so a line doesn't repeat back to back
+
+// Random clip from the event's category, not the one it played last; -1 if none
+int pickClip(RoverEvent type) {
+    int c = findCategory(roverEventName(type));
+    if (c < 0) return -1;
+    int last = -1, n = 0;
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        if (assetAt(i).category != c) continue;
+        if (i + 1 == lastClip[c]) last = i;
+        n++;
+    }
+    if (n == 0) return -1;
+    int skip = (last >= 0 && n > 1) ? last : -1;
+    int r = random(skip >= 0 ? n - 1 : n);
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        if (assetAt(i).category != c || i == skip) continue;
+        if (r-- == 0) {
+            lastClip[c] = i + 1;
+            return i;
+        }
+    }
+    return -1;
+}
+
+// "saw_human_1.mp3" in whichever category holds it
+int findClipFile(const char* file) {
+    if (!file || !file[0]) return -1;
+    size_t n = strlen(file);
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        const char* path = assetAt(i).path;
+        size_t m = strlen(path);
+        if (m > n && path[m - n - 1] == '/' && strcmp(path + m - n, file) == 0) return i;
+    }
+    return -1;
+}
+
+uint32_t clipMs(int clip) {
+    return (clip >= 0 && assetAt(clip).durationMs > 0) ? assetAt(clip).durationMs : AUDIO_UNKNOWN_MS;
+}
 
 // Flag: isManualTrigger = true skips cooldown and always plays/moves
-void performManeuver(String type, boolean isManualTrigger) {
-    Serial.println("MANEUVER: " + type + " (Manual: " + String(isManualTrigger) + ")");
+// sayFile: clip name for EVT_SAY ("saw_human_1.mp3")
+void performManeuver(RoverEvent type, boolean isManualTrigger, const char* sayFile = NULL) {
+    Serial.printf("MANEUVER: %s (Manual: %d)\n", roverEventName(type), isManualTrigger);
 
     boolean shouldPlayAudio = false;
     boolean shouldMove = false;
 
     // 1. Analyze Event Type for AUDIO
-    if (type == "saw_human") {
-        if (voiceMode == "AUTO" && !isManualTrigger) {
-            if (millis() - lastAudioTime > AUDIO_COOLDOWN) {
-                shouldPlayAudio = true;
-                lastAudioTime = millis();
-            } else { Serial.println("AUDIO BLOCKED (Cooldown)"); }
-        } else if (isManualTrigger) { shouldPlayAudio = true; }
-    } 
-    else {
-        // Collision, Stuck, Random -> Always play audio
-        shouldPlayAudio = true; 
+    switch (type) {
+        case EVT_SAW_HUMAN:
+            if (voiceMode == MODE_AUTO && !isManualTrigger) {
+                if ((long)(millis() - audioBusyUntil) >= 0) {
+                    shouldPlayAudio = true;
+                } else { Serial.println("AUDIO BLOCKED (Still talking)"); }
+            } else if (isManualTrigger) { shouldPlayAudio = true; }
+            break;
+        default:
+            // Collision, Stuck, Random -> Always play audio
+            shouldPlayAudio = true; 
+            break;
     }
 
     // 2. Analyze Event Type for MOVEMENT
     // "Manual Drive" means ONLY Joystick (or explicit manual buttons) can move motors.
     // Auto-detection events (saw_human, collision, etc) are BLOCKED in Manual Mode.
     
-    if (driveMode == "AUTO" || isManualTrigger) {
-        if (type == "saw_human") shouldMove = true;
-        else if (type == "collision") shouldMove = true;
-        else if (type == "stuck") shouldMove = true;
-        // "stop" works regardless, but handled below
-        else if (type == "random") shouldMove = true;
+    if (driveMode == MODE_AUTO || isManualTrigger) {
+        switch (type) {
+            case EVT_SAW_HUMAN:
+            case EVT_COLLISION:
+            case EVT_STUCK:
+            case EVT_RANDOM:
+                shouldMove = true;
+                break;
+            default:
+                // "stop" works regardless, but handled below
+                break;
+        }
     }
 
-    if (type == "stop") {
+    if (type == EVT_STOP) {
+        abortManeuver();
         stopMotors(); // Safety: Stop always works
         shouldMove = false; 
     }
 
+    traceMark(TRACE_DECISION);
+
     // 3. Execute Audio
+    // speechMs: from now until the line has played out on the voice page
+    uint32_t speechMs = 0;
     if (shouldPlayAudio) {
-        lastEvent = type; 
-        if(type == "saw_human") lastEvent = "SAW_HUMAN";
-        if(type == "collision") lastEvent = "COLLISION";
-        if(type == "stuck") lastEvent = "STUCK";
-        if(type == "random") lastEvent = "RANDOM";
+        traceHoldForDelivery();
+        setEvent(type);
+        if (type == EVT_SAY) {
+            strncpy(lastSayFile, sayFile ? sayFile : "", ASSET_PATH_MAX - 1);
+            lastSayFile[ASSET_PATH_MAX - 1] = '\0';
+        }
+        lastEventClip = (type == EVT_SAY) ? findClipFile(sayFile) : pickClip(type);
+        speechMs = AUDIO_LEAD_MS + clipMs(lastEventClip);
+        audioBusyUntil = millis() + speechMs + AUDIO_GAP_MS;
     }
 
     // 4. Execute Movement
+    // Steps come from /maneuvers.json and run from the control tick, so this
+    // returns right after the first motor command instead of blocking.
+    // "speech" steps hold until the line above is done.
     if (shouldMove) {
-        if (type == "saw_human") {
-            // Stop → Turn right → Move forward
-            stopMotors(); delay(500); turnRight(); delay(800); moveForward();
-        }
-        else if (type == "collision") {
-            // Stop → Backup 1 sec → Turn left → Move forward
-            stopMotors(); delay(200); moveBackward(); delay(1000); turnLeft(); delay(800); moveForward();
-        }
-        else if (type == "stuck") {
-            // Backup 2 sec → Turn 180 (Spin) → Move forward
-            stopMotors(); moveBackward(); delay(2000); turnRight(); delay(1500); moveForward();
-        }
-        else if (type == "random") {
-            int action = random(0, 4);
-            if(action == 0) { moveForward(); }
-            if(action == 1) { moveBackward(); }
-            if(action == 2) { turnLeft(); }
-            if(action == 3) { turnRight(); }
-            delay(1000); stopMotors();
-        }
+        startManeuver(type, speechMs);
+    }
+}
+
+// =============================================================
+// GALILEO EVENTS (UART)
+// =============================================================
+
+// Navigation events from layer-c-galileo, fed in by pollGalileoLink().
+// They take the same path as /detect (auto triggers: cooldown + drive mode apply).
+void handleNavEvent(NavEvent ev) {
+    switch (ev) {
+        case NAV_COLLISION: performManeuver(EVT_COLLISION, false); break;
+        case NAV_STUCK:     performManeuver(EVT_STUCK, false); break;
+        case NAV_IDLE:      performManeuver(EVT_RANDOM, false); break;
+        case NAV_RESET:     performManeuver(EVT_STOP, false); break;
+        case NAV_BOOT:      setEvent(EVT_BOOT); break;
+        default:            break; // MOVE_START / MOVE_STOP are informational only (see /status)
     }
 }
 
@@ -224,9 +316,18 @@ void logRequest(String handlerName) {
     Serial.println(handlerName);
 }
 
+// LittleFS mounts in the background at boot; file routes answer 503 until then
+bool requireStorage() {
+    if (storageReady()) return true;
+    server.sendHeader("Retry-After", "1");
+    server.send(503, "text/plain", storageFailed() ? "Storage Failed" : "Starting");
+    return false;
+}
+
 // 1. Existing Handlers (Remote/Voice)
 void handleStatic(String path, String type) {
     logRequest("STATIC: " + path);
+    if (!requireStorage()) return;
     if(LittleFS.exists(path)) {
         File file = LittleFS.open(path, "r");
         server.streamFile(file, type);
@@ -236,31 +337,57 @@ void handleStatic(String path, String type) {
         server.send(404, "text/plain", "File Missing");
     }
 }
+// Optional latency tracing: trace=<id>&ts=<client ms> as query args, or
+// "trace"/"ts" fields in a JSON body. Records are served by GET /trace.
+void beginTrace(const char* source, uint32_t parseUs, JsonDocument* body = NULL) {
+    String id = "";
+    double clientTs = -1;
+    if (body && (*body)["trace"].is<JsonVariant>()) {
+        id = (*body)["trace"].as<String>();
+        clientTs = (*body)["ts"] | -1.0;
+    } else if (server.hasArg("trace")) {
+        id = server.arg("trace");
+        if (server.hasArg("ts")) clientTs = atof(server.arg("ts").c_str());
+    }
+    traceBegin(source, id.c_str(), clientTs, parseUs);
+}
+
 void handleRoot() { handleStatic("/index.html", "text/html"); }
 void handleVoice() { handleStatic("/voice.html", "text/html"); }
 void handleAudioMap() { handleStatic("/audio_map.json", "application/json"); }
 
 // 2. DETECT HANDLER (Auto/App Trigger)
 void handleDetect() {
+    uint32_t parseUs = micros();
     logRequest("DETECT");
     sendCORS();
+    beginTrace("detect", parseUs);
     if (server.hasArg("type")) {
-        String type = server.arg("type");
+        String typeArg = server.arg("type");
+        RoverEvent type = roverEventFromName(typeArg.c_str());
+        if (type == EVT_NONE) {
+            server.send(400, "text/plain", "Unknown type: " + typeArg);
+            traceEnd();
+            return;
+        }
         // If Voice is MANUAL, we ignore "saw_human" coming from detection logic
-        if (type == "saw_human" && voiceMode == "MANUAL") {
+        if (type == EVT_SAW_HUMAN && voiceMode == MODE_MANUAL) {
             server.send(200, "text/plain", "IGNORED (Voice Manual)");
+            traceEnd();
             return;
         }
         
-        server.send(200, "text/plain", "OK: " + type);
+        server.send(200, "text/plain", "OK: " + typeArg);
         performManeuver(type, false); // isManualTrigger = false
     } else {
         server.send(400, "text/plain", "Missing type param");
     }
+    traceEnd();
 }
 
 // 3. NEW: EVENT POST HANDLER (Manual Trigger)
 void handleEventPost() {
+    uint32_t parseUs = micros();
     logRequest("EVENT_POST");
     sendCORS();
     String type = "";
@@ -269,17 +396,31 @@ void handleEventPost() {
         JsonDocument doc;
         deserializeJson(doc, server.arg("plain"));
         if (doc.containsKey("event")) type = doc["event"].as<String>();
+        beginTrace("event", parseUs, &doc);
     } else if (server.hasArg("event")) {
         type = server.arg("event");
+        beginTrace("event", parseUs);
     }
 
-    if (type != "") {
+    RoverEvent evt = roverEventFromName(type.c_str());
+    // "SAY:<file>": a bare "SAY" has no file, and a name that doesn't fit
+    // lastSayFile can't be a clip either
+    const char* sayFile = NULL;
+    if (evt == EVT_SAY) {
+        if (type.length() > 4 && type[3] == ':' && type.length() - 4 < ASSET_PATH_MAX) {
+            sayFile = type.c_str() + 4;
+        } else {
+            evt = EVT_NONE;
+        }
+    }
+    if (evt != EVT_NONE) {
         // Manual triggers ALWAYS fire
-        performManeuver(type, true); // isManualTrigger = true
+        performManeuver(evt, true, sayFile); // isManualTrigger = true
         server.send(200, "application/json", "{\"status\":\"ok\"}");
     } else {
         server.send(400, "text/plain", "Bad Request");
     }
+    traceEnd();
 }
 
 // 4. NEW: MODE SETTER
@@ -289,22 +430,110 @@ void handleSetMode() {
     if (server.hasArg("plain")) {
         JsonDocument doc;
         deserializeJson(doc, server.arg("plain"));
-        if (doc.containsKey("drive")) driveMode = doc["drive"].as<String>();
-        if (doc.containsKey("voice")) voiceMode = doc["voice"].as<String>();
+        RoverMode drive = doc["drive"].is<const char*>() ? roverModeFromName(doc["drive"]) : driveMode;
+        RoverMode voice = doc["voice"].is<const char*>() ? roverModeFromName(doc["voice"]) : voiceMode;
+        if (drive == MODE_INVALID || voice == MODE_INVALID) {
+            server.send(400, "application/json", "{\"status\":\"bad mode\"}");
+            return;
+        }
+        if (drive != driveMode) {
+            // Manual driving: the Galileo stops wandering so it doesn't fight the joystick
+            // (kept and resent by the link until the Galileo ACKs it)
+            LinkCommand pause = { CMD_PAUSE_WANDER, 0, (uint16_t)(drive == MODE_MANUAL) };
+            if (!galileoSendCommand(pause)) {
+                server.send(503, "application/json", "{\"status\":\"busy\"}");
+                return;
+            }
+        }
+        driveMode = drive;
+        voiceMode = voice;
         
-        Serial.println("MODES UPDATED -> Drive: " + driveMode + ", Voice: " + voiceMode);
+        Serial.printf("MODES UPDATED -> Drive: %s, Voice: %s\n", roverModeName(driveMode), roverModeName(voiceMode));
     }
     server.send(200, "application/json", "{\"status\":\"ok\"}");
 }
 
 
+// 4b. Galileo navigation commands (forwarded over the UART link)
+void handleNavCommand() {
+    logRequest("NAV_COMMAND");
+    sendCORS();
+    JsonDocument doc;
+    if (!server.hasArg("plain") || deserializeJson(doc, server.arg("plain"))) {
+        server.send(400, "application/json", "{\"status\":\"bad json\"}");
+        return;
+    }
+    const char* name = doc["command"] | "";
+    long value = doc["value"] | 0L;
+    LinkCommand cmd = { 0, 0, 0 };
+    if (strcasecmp(name, "stop") == 0) {
+        cmd.id = CMD_STOP;
+    } else if (strcasecmp(name, "pause") == 0 || strcasecmp(name, "resume") == 0) {
+        cmd.id = CMD_PAUSE_WANDER;
+        cmd.value = strcasecmp(name, "pause") == 0;
+    } else if (strcasecmp(name, "speed") == 0 && value >= LINK_SPEED_MIN_PCT && value <= LINK_SPEED_MAX_PCT) {
+        cmd.id = CMD_SET_SPEED;
+        cmd.value = value;
+    } else if (strcasecmp(name, "threshold") == 0) {
+        // 0 = the Galileo's default, anything else within the link limits
+        const char* which = doc["name"] | "";
+        cmd.id = CMD_SET_THRESHOLD;
+        cmd.value = value;
+        if (strcasecmp(which, "distance") == 0) {
+            cmd.arg = THRESH_COLLISION_CM;
+            if (value != 0 && (value < LINK_COLLISION_CM_MIN || value > LINK_COLLISION_CM_MAX)) cmd.id = 0;
+        } else if (strcasecmp(which, "ttc") == 0) {
+            cmd.arg = THRESH_TTC_MS;
+            if (value != 0 && (value < LINK_TTC_MS_MIN || value > LINK_TTC_MS_MAX)) cmd.id = 0;
+        } else {
+            cmd.id = 0;
+        }
+    }
+    if (cmd.id == 0) {
+        server.send(400, "application/json", "{\"status\":\"bad command\"}");
+        return;
+    }
+    if (!galileoSendCommand(cmd)) {
+        server.send(503, "application/json", "{\"status\":\"busy\"}");
+        return;
+    }
+    server.send(200, "application/json", "{\"status\":\"queued\"}");
+}
+
 void handleStatus() {
     // logRequest("STATUS"); // Reduce spam
     sendCORS();
     JsonDocument doc;
-    doc["driveMode"] = driveMode;
-    doc["voiceMode"] = voiceMode;
-    doc["distance"] = -1; // No sensor in this config
+    doc["driveMode"] = roverModeName(driveMode);
+    doc["voiceMode"] = roverModeName(voiceMode);
+    doc["distance"] = galileoDistanceCm(); // -1 until the Galileo reports one
+
+    GalileoLinkStats link = galileoLinkStats();
+    JsonObject nav = doc["nav"].to<JsonObject>();
+    nav["lastEvent"] = galileoLastEvent();
+    nav["frames"] = link.frames;
+    nav["rxBytes"] = link.rxBytes;
+    nav["overflows"] = link.overflows;
+    nav["crcErrors"] = link.crcErrors;
+    nav["duplicates"] = link.duplicates;
+    nav["unknown"] = link.unknown;
+    nav["ageMs"] = link.lastRxMs ? (long)(millis() - link.lastRxMs) : -1;
+    nav["telemetry"] = link.telemetry;
+    nav["telemetryLost"] = link.telemetryLost;
+    nav["commandsAcked"] = link.commandsAcked;
+    nav["commandsFailed"] = link.commandsFailed;
+    nav["pauseSynced"] = galileoWanderPauseSynced();
+
+    LinkTelemetry t;
+    if (galileoTelemetry(t)) {
+        JsonObject tl = doc["telemetry"].to<JsonObject>();
+        tl["bumperLeft"] = (t.bumpers & TLM_BUMP_LEFT) != 0;
+        tl["bumperRight"] = (t.bumpers & TLM_BUMP_RIGHT) != 0;
+        tl["resetHeld"] = t.resetHeld;
+        tl["motion"] = t.motion < TELEMETRY_MOTION_COUNT ? TELEMETRY_MOTION_NAMES[t.motion] : "?";
+        tl["driveState"] = t.driveState;
+        tl["overruns"] = t.overruns;
+    }
     String out;
     serializeJson(doc, out);
     server.send(200, "application/json", out);
@@ -315,63 +544,295 @@ void handleEventGet() {
     // logRequest("EVENT_POLL"); // Commented out to reduce spam
     sendCORS();
     JsonDocument doc;
-    doc["event"] = lastEvent;
+    char name[ASSET_PATH_MAX + 4];
+    if (lastEvent == EVT_SAY) snprintf(name, sizeof(name), "SAY:%s", lastSayFile);
+    else strcpy(name, roverEventName(lastEvent));
+    doc["event"] = name;
+    if (lastEventClip >= 0) {
+        // The clip the rover timed itself to; play this one, not a random pick
+        doc["clip"] = assetAt(lastEventClip).path;
+        doc["ms"] = assetAt(lastEventClip).durationMs;
+    }
+    if (lastEvent != EVT_NONE) {
+        // Traced requests get their id echoed and the delivery stage stamped
+        const char* traceId = tracePendingDeliveryId();
+        if (traceId[0]) doc["trace"] = traceId;
+        traceDelivered();
+    }
     String out;
     serializeJson(doc, out);
-    lastEvent = ""; 
+    lastEvent = EVT_NONE; 
+    lastEventClip = -1;
     server.send(200, "application/json", out);
 }
 
 // 6. Legacy Joystick Handler
 void handleMove() {
+    uint32_t parseUs = micros();
     logRequest("MOVE");
     sendCORS();
     if (server.hasArg("plain")) {
         JsonDocument doc;
         deserializeJson(doc, server.arg("plain"));
+        beginTrace("move", parseUs, &doc);
         int x = doc["x"];
         int y = doc["y"];
         moveMotorsLegacy(x, y);
     }
     server.send(200, "application/json", "{\"ok\":true}");
+    traceEnd();
+}
+
+// 7. Latency breakdown for traced requests
+void handleTrace() {
+    sendCORS();
+    JsonDocument doc;
+    traceToJson(doc);
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+}
+
+static uint8_t clipBuf[2048];
+
+// Exactly a.size bytes of clip i, from the archive or its own file. Short
+// reads (file gone since indexing) are zero-filled so the framing holds.
+static void sendAssetBody(uint8_t i) {
+    uint32_t size = assetAt(i).size;
+    for (uint32_t pos = 0; pos < size; ) {
+        size_t want = size - pos < sizeof(clipBuf) ? size - pos : sizeof(clipBuf);
+        size_t got = readAsset(i, pos, clipBuf, want);
+        if (got < want) memset(clipBuf + got, 0, want - got);
+        server.sendContent((const char*)clipBuf, want);
+        pos += want;
+    }
 }
 
 // Audio Wildcard
 void handleAudio() {
     logRequest("AUDIO");
     sendCORS();
-    String path = server.uri();
-    if(LittleFS.exists(path)) {
-        File f = LittleFS.open(path, "r");
-        server.streamFile(f, "audio/mpeg");
-        f.close();
+    if (!requireStorage()) return;
+    int i = findAsset(server.uri().c_str()); // indexed at boot, no directory walk
+    if (i >= 0) {
+        server.setContentLength(assetAt(i).size);
+        server.send(200, assetContentType(i), "");
+        sendAssetBody(i);
     } else {
         server.send(404, "text/plain", "Audio Not Found");
     }
 }
 
+// Clip bundle: every clip in a category (or all of them) in one response, so
+// the voice page can warm its cache with a single request. It goes out
+// synchronously and holds up loop() for the whole transfer, so the rover is
+// stopped first; the ETag lets a client that already has it skip all that.
+// Format (little-endian):
+//   "SRB1"  u16 clipCount
+//   per clip: u8 pathLen, path ("/COLLISION/collision_1.mp3"), u32 size, data
+static void putLE(uint8_t* p, uint32_t v, uint8_t bytes) {
+    for (uint8_t i = 0; i < bytes; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+void handleBundle() {
+    logRequest("BUNDLE");
+    sendCORS();
+    if (!requireStorage()) return;
+
+    int cat = -1;
+    if (server.hasArg("category")) {
+        cat = findCategory(server.arg("category").c_str());
+        if (cat < 0) {
+            server.send(404, "text/plain", "Unknown category");
+            return;
+        }
+    }
+
+    // Sizes come from the boot-time index, so the length is known up front.
+    // The ETag hashes the same entries (FNV-1a over path, size, offset).
+    uint16_t count = 0;
+    size_t total = 6;
+    uint32_t hash = 2166136261u;
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        const AssetEntry& a = assetAt(i);
+        if (cat >= 0 && a.category != cat) continue;
+        total += 1 + strlen(a.path) + 4 + a.size;
+        count++;
+        for (const char* p = a.path; *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619u;
+        hash = (hash ^ a.size) * 16777619u;
+        hash = (hash ^ a.offset) * 16777619u;
+    }
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)hash);
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "max-age=3600");
+    if (server.header("If-None-Match") == etag) {
+        server.send(304, "application/octet-stream", "");
+        return;
+    }
+
+    abortManeuver();
+    stopMotors();  // nothing drives while loop() is stuck in here
+
+    uint8_t* buf = clipBuf;
+    memcpy(buf, "SRB1", 4);
+    putLE(buf + 4, count, 2);
+    server.setContentLength(total);
+    server.send(200, "application/octet-stream", "");
+    server.sendContent((const char*)buf, 6);
+
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        const AssetEntry& a = assetAt(i);
+        if (cat >= 0 && a.category != cat) continue;
+        if (!server.client().connected()) break;  // client gave up
+
+        uint8_t nameLen = strlen(a.path);
+        buf[0] = nameLen;
+        memcpy(buf + 1, a.path, nameLen);
+        putLE(buf + 1 + nameLen, a.size, 4);
+        server.sendContent((const char*)buf, 1 + nameLen + 4);
+        sendAssetBody(i);
+    }
+}
+
+// Maneuver definitions: GET returns the JSON in use, POST compiles + saves it
+void handleManeuversGet() {
+    sendCORS();
+    if (!requireStorage()) return;
+    if (LittleFS.exists(MANEUVER_FILE)) {
+        File f = LittleFS.open(MANEUVER_FILE, "r");
+        server.streamFile(f, "application/json");
+        f.close();
+    } else {
+        server.send(404, "text/plain", "Using built-in maneuvers");
+    }
+}
+
+void handleManeuversPost() {
+    logRequest("MANEUVERS");
+    sendCORS();
+    if (!server.hasArg("plain")) {
+        server.send(400, "text/plain", "Missing JSON body");
+        return;
+    }
+    if (!requireStorage()) return;
+    String body = server.arg("plain");
+    String error;
+    if (!compileManeuvers(body.c_str(), body.length(), error)) {
+        JsonDocument doc;
+        doc["status"] = "error";
+        doc["error"] = error;
+        String out;
+        serializeJson(doc, out);
+        server.send(400, "application/json", out);
+        return;
+    }
+    // Already in use; saving it is what makes it survive a reboot
+    File f = LittleFS.open(MANEUVER_FILE, "w");
+    if (!f) {
+        server.send(500, "text/plain", "Could not save " MANEUVER_FILE);
+        return;
+    }
+    size_t written = f.print(body);
+    f.close();
+    if (written != body.length()) {
+        server.send(500, "text/plain", "Could not save " MANEUVER_FILE);
+        return;
+    }
+    server.send(200, "application/json", "{\"status\":\"ok\",\"bytes\":" + String(maneuverCodeSize()) + "}");
+}
+
+// Runtime metrics (loop CPU-busy %, wakeups, heap)
+void handleMetrics() {
+    sendCORS();
+    JsonDocument doc;
+    loopMetricsToJson(doc);
+    doc["heapFree"] = ESP.getFreeHeap();
+    doc["uptimeMs"] = millis();
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+}
+
+// OTA upload: multipart chunks stream straight into the update partition
+// (gzip inflated on the fly). Query args are parsed before the body, so
+// target/sha256 are available at UPLOAD_FILE_START.
+void handleOtaUpload() {
+    HTTPUpload& upload = server.upload();
+    if (upload.status == UPLOAD_FILE_START) {
+        abortManeuver();
+        stopMotors();  // nothing moves while flash is being written
+        OtaTarget target = server.arg("target") == "filesystem" ? OTA_FILESYSTEM : OTA_FIRMWARE;
+        otaBegin(target, server.arg("sha256").c_str());
+    } else if (upload.status == UPLOAD_FILE_WRITE) {
+        otaWrite(upload.buf, upload.currentSize);
+    } else if (upload.status == UPLOAD_FILE_END) {
+        otaEnd();
+    } else if (upload.status == UPLOAD_FILE_ABORTED) {
+        otaAbort();
+    }
+}
+
+// Response once the upload is done (or never started)
+void handleOtaDone() {
+    logRequest("OTA");
+    sendCORS();
+    JsonDocument doc;
+    otaToJson(doc);
+    String out;
+    serializeJson(doc["ota"], out);
+    server.send(otaSucceeded() ? 200 : 400, "application/json", out);
+}
+
+void handleOtaGet() {
+    sendCORS();
+    JsonDocument doc;
+    otaToJson(doc);
+    String out;
+    serializeJson(doc["ota"], out);
+    server.send(200, "application/json", out);
+}
+
+// Boot timeline (micros since power-on per stage)
+void handleBoot() {
+    sendCORS();
+    JsonDocument doc;
+    bootTimelineToJson(doc);
+    doc["storageReady"] = storageReady();
+    doc["clips"] = assetCount();
+    String out;
+    serializeJson(doc, out);
+    server.send(200, "application/json", out);
+}
+
 // =============================================================
 // SETUP
 // =============================================================
 
+// Boot order is chosen so nothing waits on anything it doesn't need:
+// motors are made safe first, LittleFS mounts + indexes on a core-0 task
+// while WiFi starts and routes register here. Drive routes work as soon as
+// the server is up; file routes return 503 until storage is ready.
 void setup() {
+    bootMark("setup");
     Serial.begin(115200);
-    delay(1000);
     Serial.println("\n\n=== BOOT STARTS ===");
     
     setupMotors();
     Serial.println("MOTORS: INITIALIZED (STOPPED)");
+    setupManeuvers(driveMotors); // built-in defaults until /maneuvers.json loads
+    bootMark("motors");
 
-    // LittleFS
-    if(!LittleFS.begin(true)){
-        Serial.println("!!! LittleFS Mount Failed !!!");
-        return;
-    }
-    Serial.println("LittleFS Mounted: OK");
+    setupGalileoLink(handleNavEvent);
+    bootMark("uart");
+
+    // LittleFS (background)
+    startStorage();
 
     // WiFi
     WiFi.mode(WIFI_AP);
     WiFi.softAP(AP_SSID, AP_PASSWORD);
+    bootMark("wifi_ap");
     
     IPAddress IP = WiFi.softAPIP();
     Serial.print("Access Point IP: ");
@@ -387,6 +848,15 @@ void setup() {
     server.on("/event", HTTP_POST, handleEventPost); // FIX: Allow POST
     server.on("/move", HTTP_POST, handleMove);
     server.on("/mode", HTTP_POST, handleSetMode);    // FIX: Set Mode
+    server.on("/nav", HTTP_POST, handleNavCommand);
+    server.on("/trace", HTTP_GET, handleTrace);
+    server.on("/boot", HTTP_GET, handleBoot);
+    server.on("/metrics", HTTP_GET, handleMetrics);
+    server.on("/bundle", HTTP_GET, handleBundle);
+    server.on("/maneuvers", HTTP_GET, handleManeuversGet);
+    server.on("/maneuvers", HTTP_POST, handleManeuversPost);
+    server.on("/ota", HTTP_GET, handleOtaGet);
+    server.on("/ota", HTTP_POST, handleOtaDone, handleOtaUpload);
     
     server.on("/move", HTTP_OPTIONS, [](){ sendCORS(); server.send(204); });
     server.on("/detect", HTTP_OPTIONS, [](){ sendCORS(); server.send(204); });
@@ -397,21 +867,44 @@ void setup() {
         Serial.print(server.method() == HTTP_GET ? "GET " : "POST ");
         Serial.println(server.uri());
         
-        if(server.uri().endsWith(".mp3")) {
+        // Indexed clips by name; before the index is up, anything that looks
+        // like one gets handleAudio()'s 503 rather than a 404
+        const String& uri = server.uri();
+        bool clip = storageReady() ? findAsset(uri.c_str()) >= 0
+                                   : uri.endsWith(".mp3") || uri.endsWith(".wav");
+        if (clip) {
             handleAudio();
         } else {
             server.send(404, "text/plain", "404 Not Found (Debug Mode)");
         }
     });
 
+    static const char* COLLECT_HEADERS[] = { "If-None-Match" };  // /bundle revalidation
+    server.collectHeaders(COLLECT_HEADERS, 1);
     server.begin();
+    setupLoopWait();
+    bootMark("http_ready");
     Serial.println("HTTP Server Started");
     Serial.println("=== READY ===");
 }
 
+bool maneuverFileLoaded = false;
+
 void loop() {
     server.handleClient();
-    delay(1);
+    pollGalileoLink(); // Non-blocking: drains bytes queued by the UART callback
+    serviceManeuvers(); // Steps any running maneuver by the elapsed control ticks
+    serviceOta();       // Restarts into a freshly verified image
+
+    if (!maneuverFileLoaded && storageReady()) {
+        loadManeuverFile();
+        loadAssetMeta();
+        maneuverFileLoaded = true;
+    }
+
+    // Sleep until a socket has data or another task calls wakeLoop()
+    // (UART bytes, maneuver tick, storage ready). Replaces delay(1) polling.
+    waitForWork(galileoCommandPending() ? LINK_ACK_TIMEOUT_MS : LOOP_IDLE_WAIT_MS);
     // Note: No autonomous loop here anymore. 
-    // Movement is purely event-driven by /detect or joystick.
+    // Movement is event-driven by /detect, the joystick or Galileo UART events.
 }
@@ -0,0 +1,210 @@
+#include "maneuvers.h"
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include "loop_wait.h"
+
+// Bytecode (one program per RoverEvent, concatenated):
+//   0x00                 END
+//   0x10 | MotorCmd      MOTOR  set the drive state
+//   0x1F                 MOTOR  random forward/backward/left/right
+//   0x20                 WAIT   until the speech started with the maneuver ends
+//   0x80 | hi7, lo8      WAIT   15-bit tick count (MANEUVER_TICK_MS each)
+#define OP_END           0x00
+#define OP_MOTOR         0x10
+#define OP_MOTOR_RANDOM  0x1F
+#define OP_WAIT_SPEECH   0x20
+#define OP_WAIT          0x80
+#define WAIT_MAX_TICKS   0x7FFF
+#define NO_PROGRAM       0xFFFF
+
+// Same content as data/maneuvers.json; used until (or if) the file loads
+static const char DEFAULT_MANEUVERS[] = R"json({
+  "saw_human": [ {"move": "stop", "ms": 500}, {"move": "right", "ms": 800}, {"move": "stop", "ms": "speech"}, {"move": "forward"} ],
+  "collision": [ {"move": "stop", "ms": 200}, {"move": "backward", "ms": 1000}, {"move": "left", "ms": 800}, {"move": "forward"} ],
+  "stuck":     [ {"move": "stop"}, {"move": "backward", "ms": 2000}, {"move": "right", "ms": 1500}, {"move": "forward"} ],
+  "random":    [ {"move": "any", "ms": 1000}, {"move": "stop"} ]
+})json";
+
+static const char* MOVE_NAMES[MOTOR_CMD_COUNT] = { "stop", "forward", "backward", "left", "right" };
+
+static uint8_t code[MANEUVER_CODE_SIZE];
+static uint16_t codeSize = 0;
+static uint16_t entry[EVT_COUNT];
+
+static MotorDriver drive = NULL;
+
+// Interpreter state
+static uint16_t pc = NO_PROGRAM;
+static uint16_t waitTicks = 0;
+static uint32_t elapsedTicks = 0;   // since startManeuver()
+static uint32_t speechTicks = 0;    // length of the line started with it
+
+static volatile uint32_t tickCount = 0;
+static uint32_t ticksServiced = 0;
+static esp_timer_handle_t tickTimer = NULL;
+static bool tickRunning = false;
+
+// esp_timer task context: count the tick and let loop() run it
+static void onControlTick(void*) {
+    tickCount++;
+    wakeLoop();
+}
+
+// The tick only runs while a program does, so a parked rover has no 100 Hz wakeup
+static void startTick() {
+    if (tickRunning || !tickTimer) return;
+    esp_timer_start_periodic(tickTimer, MANEUVER_TICK_MS * 1000);
+    tickRunning = true;
+}
+
+static void stopTick() {
+    if (!tickRunning) return;
+    esp_timer_stop(tickTimer);
+    tickRunning = false;
+}
+
+// Executes until the next WAIT or END. Everything here is table lookups and
+// motor calls; no heap, no blocking.
+static void runUntilWait() {
+    while (pc != NO_PROGRAM) {
+        uint8_t op = code[pc++];
+        if (op & OP_WAIT) {
+            waitTicks = ((op & 0x7F) << 8) | code[pc++];
+            if (waitTicks > 0) return;
+        } else if (op == OP_WAIT_SPEECH) {
+            uint32_t left = speechTicks > elapsedTicks ? speechTicks - elapsedTicks : 0;
+            waitTicks = left > WAIT_MAX_TICKS ? WAIT_MAX_TICKS : left;
+            if (waitTicks > 0) return;
+        } else if (op == OP_MOTOR_RANDOM) {
+            drive((MotorCmd)random(MOTOR_FORWARD, MOTOR_RIGHT + 1));
+        } else if ((op & 0xF0) == OP_MOTOR) {
+            drive((MotorCmd)(op & 0x0F));
+        } else {
+            pc = NO_PROGRAM;  // OP_END
+        }
+    }
+}
+
+static int moveFromName(const char* name) {
+    if (name == NULL) return -1;
+    if (strcasecmp(name, "any") == 0) return OP_MOTOR_RANDOM;
+    for (uint8_t i = 0; i < MOTOR_CMD_COUNT; i++) {
+        if (strcasecmp(name, MOVE_NAMES[i]) == 0) return OP_MOTOR | i;
+    }
+    return -1;
+}
+
+bool compileManeuvers(const char* json, size_t len, String& error) {
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, json, len);
+    if (err) { error = String("json: ") + err.c_str(); return false; }
+    if (!doc.is<JsonObject>()) { error = "expected an object of maneuvers"; return false; }
+
+    uint8_t out[MANEUVER_CODE_SIZE];
+    uint16_t n = 0;
+    uint16_t starts[EVT_COUNT];
+    for (uint8_t i = 0; i < EVT_COUNT; i++) starts[i] = NO_PROGRAM;
+
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        RoverEvent evt = roverEventFromName(kv.key().c_str());
+        if (evt == EVT_NONE || evt == EVT_SAY) { error = String("unknown event: ") + kv.key().c_str(); return false; }
+        JsonArray steps = kv.value().as<JsonArray>();
+        if (steps.isNull()) { error = String(kv.key().c_str()) + ": expected a list of steps"; return false; }
+
+        starts[evt] = n;
+        uint8_t stepNo = 0;
+        for (JsonObject step : steps) {
+            int op = moveFromName(step["move"]);
+            bool untilSpeech = step["ms"].is<const char*>() && strcasecmp(step["ms"], "speech") == 0;
+            uint32_t ticks = ((uint32_t)(step["ms"] | 0) + MANEUVER_TICK_MS - 1) / MANEUVER_TICK_MS;
+            if (op < 0) { error = String(kv.key().c_str()) + " step " + stepNo + ": bad move"; return false; }
+            if (step["ms"].is<const char*>() && !untilSpeech) { error = String(kv.key().c_str()) + " step " + stepNo + ": ms must be a number or \"speech\""; return false; }
+            if (ticks > WAIT_MAX_TICKS) { error = String(kv.key().c_str()) + " step " + stepNo + ": ms too long"; return false; }
+            // The step plus this event's OP_END still have to fit
+            uint8_t len = 1 + (untilSpeech ? 1 : ticks > 0 ? 2 : 0);
+            if (n + len + 1 > MANEUVER_CODE_SIZE) { error = "program too large"; return false; }
+            out[n++] = (uint8_t)op;
+            if (untilSpeech) {
+                out[n++] = OP_WAIT_SPEECH;
+            } else if (ticks > 0) {
+                out[n++] = OP_WAIT | (uint8_t)(ticks >> 8);
+                out[n++] = (uint8_t)(ticks & 0xFF);
+            }
+            stepNo++;
+        }
+        if (n >= MANEUVER_CODE_SIZE) { error = "program too large"; return false; }
+        out[n++] = OP_END;
+    }
+
+    abortManeuver();  // entry offsets are about to change
+    memcpy(code, out, n);
+    memcpy(entry, starts, sizeof(entry));
+    codeSize = n;
+    return true;
+}
+
+void setupManeuvers(MotorDriver driver) {
+    drive = driver;
+    String error;
+    if (!compileManeuvers(DEFAULT_MANEUVERS, strlen(DEFAULT_MANEUVERS), error)) {
+        Serial.println("MANEUVERS: DEFAULTS INVALID: " + error);
+    }
+
+    esp_timer_create_args_t args = {};
+    args.callback = onControlTick;
+    args.name = "maneuver_tick";
+    esp_timer_create(&args, &tickTimer);
+}
+
+void loadManeuverFile() {
+    if (!LittleFS.exists(MANEUVER_FILE)) return;
+    File f = LittleFS.open(MANEUVER_FILE, "r");
+    String json = f.readString();
+    f.close();
+
+    String error;
+    if (compileManeuvers(json.c_str(), json.length(), error)) {
+        Serial.println("MANEUVERS: LOADED " + String(codeSize) + " BYTES");
+    } else {
+        Serial.println("MANEUVERS: " MANEUVER_FILE " REJECTED: " + error);
+    }
+}
+
+bool startManeuver(RoverEvent evt, uint32_t speechMs) {
+    if (evt >= EVT_COUNT || entry[evt] == NO_PROGRAM) return false;
+    pc = entry[evt];
+    waitTicks = 0;
+    elapsedTicks = 0;
+    speechTicks = (speechMs + MANEUVER_TICK_MS - 1) / MANEUVER_TICK_MS;
+    ticksServiced = tickCount;  // don't count ticks from before the start
+    runUntilWait();
+    if (pc != NO_PROGRAM) startTick();
+    return true;
+}
+
+void abortManeuver() {
+    pc = NO_PROGRAM;
+    waitTicks = 0;
+    stopTick();
+}
+
+bool maneuverRunning() {
+    return pc != NO_PROGRAM;
+}
+
+void serviceManeuvers() {
+    uint32_t now = tickCount;
+    while (ticksServiced != now) {
+        ticksServiced++;
+        if (pc == NO_PROGRAM) continue;
+        elapsedTicks++;
+        if (waitTicks > 0 && --waitTicks > 0) continue;
+        runUntilWait();
+    }
+    if (pc == NO_PROGRAM) stopTick();
+}
+
+size_t maneuverCodeSize() {
+    return codeSize;
+}
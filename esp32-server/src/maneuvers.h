@@ -0,0 +1,59 @@
+#ifndef MANEUVERS_H
+#define MANEUVERS_H
+
+#include <Arduino.h>
+#include "rover_types.h"
+
+// Data-driven maneuvers. /maneuvers.json maps event names to motor steps:
+//
+//   { "collision": [ {"move": "stop", "ms": 200}, {"move": "backward", "ms": 1000},
+//                    {"move": "left", "ms": 800}, {"move": "forward"} ] }
+//
+// move: stop | forward | backward | left | right | any (random direction).
+// ms:   how long to hold it before the next step (omitted/0 = next step at once;
+//       the last step's motor state is left running, like moveForward()), or
+//       "speech": hold until the event's voice line has finished, counted from
+//       the start of the maneuver (no line playing = no wait).
+//
+// The file is compiled once into a compact bytecode; execution runs from the
+// fixed-rate control tick and never allocates.
+
+#define MANEUVER_TICK_MS     10
+#define MANEUVER_CODE_SIZE   256
+#define MANEUVER_FILE        "/maneuvers.json"
+
+enum MotorCmd : uint8_t {
+    MOTOR_STOP = 0,
+    MOTOR_FORWARD,
+    MOTOR_BACKWARD,
+    MOTOR_LEFT,
+    MOTOR_RIGHT,
+    MOTOR_CMD_COUNT
+};
+
+typedef void (*MotorDriver)(MotorCmd cmd);
+
+// Compiles the built-in defaults and starts the control tick.
+void setupManeuvers(MotorDriver driver);
+
+// Compiles a JSON document into the live program. On failure the running
+// program is kept and `error` describes the first problem.
+bool compileManeuvers(const char* json, size_t len, String& error);
+
+// Replaces the defaults with MANEUVER_FILE if present (call once storage is up).
+void loadManeuverFile();
+
+// Starts the program for `evt` (replacing any running one) and executes its
+// first steps immediately. speechMs: how long the line that goes with it
+// plays, for "speech" steps. Returns false if `evt` has no maneuver.
+bool startManeuver(RoverEvent evt, uint32_t speechMs = 0);
+void abortManeuver();
+bool maneuverRunning();
+
+// Runs every control tick that elapsed since the last call. Call from loop().
+void serviceManeuvers();
+
+// Compiled size in bytes (for /maneuvers)
+size_t maneuverCodeSize();
+
+#endif
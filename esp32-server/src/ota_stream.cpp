@@ -0,0 +1,617 @@
+#include "ota_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define OTA_WINDOW_SIZE  32768          // deflate's maximum distance
+#define OTA_WINDOW_MASK  (OTA_WINDOW_SIZE - 1)
+#define OTA_INPUT_SIZE   1024
+#define OTA_FLUSH_CHUNK  4096
+
+// Input that must be buffered before decoding a unit, so a unit never stops
+// halfway for lack of bytes: a dynamic block header is at most ~290 bytes,
+// one length/distance pair at most 6.
+#define NEED_BLOCK_HEADER  300
+#define NEED_SYMBOL        8
+
+enum {
+    ST_GZ_HEADER = 0,
+    ST_BLOCK,
+    ST_STORED_LEN,
+    ST_STORED,
+    ST_CODES,
+    ST_TRAILER,
+    ST_DONE,
+    ST_ERROR
+};
+
+// gzip header flag bits
+#define FHCRC     0x02
+#define FEXTRA    0x04
+#define FNAME     0x08
+#define FCOMMENT  0x10
+
+static const uint16_t LEN_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t LEN_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DIST_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577 };
+static const uint8_t DIST_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t CLEN_ORDER[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* p, size_t n) {
+    crc = ~crc;
+    while (n--) {
+        crc ^= *p++;
+        for (uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// =============================================================
+// GzipInflater
+// =============================================================
+
+bool GzipInflater::begin(Sink sink, void* ctx) {
+    sink_ = sink;
+    ctx_ = ctx;
+    window_ = (uint8_t*)malloc(OTA_WINDOW_SIZE);
+    in_ = (uint8_t*)malloc(OTA_INPUT_SIZE);
+    lencode_ = (Huffman*)malloc(sizeof(Huffman));
+    distcode_ = (Huffman*)malloc(sizeof(Huffman));
+    wpos_ = flushed_ = total_ = 0;
+    crc_ = 0;
+    inPos_ = inEnd_ = 0;
+    bitBuf_ = 0;
+    bitCnt_ = 0;
+    state_ = ST_GZ_HEADER;
+    hdrFlags_ = 0;
+    hdrCount_ = 0;
+    hdrExtra_ = 0;
+    lastBlock_ = false;
+    storedLeft_ = 0;
+    trailerLen_ = 0;
+    error_ = NULL;
+    if (!window_ || !in_ || !lencode_ || !distcode_) {
+        end();
+        return fail("out of memory");
+    }
+    return true;
+}
+
+void GzipInflater::end() {
+    free(window_);
+    free(in_);
+    free(lencode_);
+    free(distcode_);
+    window_ = in_ = NULL;
+    lencode_ = distcode_ = NULL;
+}
+
+bool GzipInflater::fail(const char* msg) {
+    if (!error_) error_ = msg;
+    state_ = ST_ERROR;
+    return false;
+}
+
+bool GzipInflater::feed(const uint8_t* data, size_t len) {
+    if (state_ == ST_ERROR) return false;
+    while (len > 0) {
+        // Compact, then top up the input buffer
+        if (inPos_ > 0) {
+            memmove(in_, in_ + inPos_, inEnd_ - inPos_);
+            inEnd_ -= inPos_;
+            inPos_ = 0;
+        }
+        size_t n = OTA_INPUT_SIZE - inEnd_;
+        if (n > len) n = len;
+        memcpy(in_ + inEnd_, data, n);
+        inEnd_ += n;
+        data += n;
+        len -= n;
+        if (!run(false)) return false;
+    }
+    return flush();
+}
+
+bool GzipInflater::finish() {
+    if (state_ == ST_ERROR) return false;
+    if (!run(true) || !flush()) return false;
+    if (state_ != ST_DONE) return fail("truncated stream");
+    return true;
+}
+
+// ---- bit input (LSB first, one byte at a time so byte alignment is exact)
+
+bool GzipInflater::needBits(uint8_t n) {
+    while (bitCnt_ < n) {
+        if (inPos_ == inEnd_) return false;
+        bitBuf_ |= (uint32_t)in_[inPos_++] << bitCnt_;
+        bitCnt_ += 8;
+    }
+    return true;
+}
+
+uint32_t GzipInflater::bits(uint8_t n) {
+    if (n == 0) return 0;
+    if (!needBits(n)) {
+        fail("truncated stream");
+        return 0;
+    }
+    uint32_t v = bitBuf_ & ((1u << n) - 1);
+    bitBuf_ >>= n;
+    bitCnt_ -= n;
+    return v;
+}
+
+// Canonical Huffman decode, one bit at a time: small tables, no lookup
+// arrays to build, fast enough for flash write speeds.
+int GzipInflater::decode(const Huffman& h) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len <= 15; len++) {
+        code |= (int)bits(1);
+        if (state_ == ST_ERROR) return -1;
+        int count = h.count[len];
+        if (code - count < first) return h.symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -1;  // not a valid code
+}
+
+// Returns 0 for a complete code, >0 for incomplete, <0 for over-subscribed
+int GzipInflater::build(Huffman& h, const uint8_t* lengths, int n) {
+    uint16_t offs[16];
+    memset(h.count, 0, sizeof(h.count));
+    for (int s = 0; s < n; s++) h.count[lengths[s]]++;
+    if (h.count[0] == n) return 0;
+
+    int left = 1;
+    for (int len = 1; len <= 15; len++) {
+        left <<= 1;
+        left -= h.count[len];
+        if (left < 0) return left;
+    }
+    offs[1] = 0;
+    for (int len = 1; len < 15; len++) offs[len + 1] = offs[len] + h.count[len];
+    for (int s = 0; s < n; s++) {
+        if (lengths[s] != 0) h.symbol[offs[lengths[s]]++] = s;
+    }
+    return left;
+}
+
+// ---- output
+
+void GzipInflater::put(uint8_t b) {
+    window_[wpos_ & OTA_WINDOW_MASK] = b;
+    wpos_++;
+    total_++;
+}
+
+bool GzipInflater::flush() {
+    while (flushed_ != wpos_) {
+        uint32_t start = flushed_ & OTA_WINDOW_MASK;
+        uint32_t n = wpos_ - flushed_;
+        if (n > OTA_WINDOW_SIZE - start) n = OTA_WINDOW_SIZE - start;  // up to the wrap
+        crc_ = crc32Update(crc_, window_ + start, n);
+        if (!sink_(ctx_, window_ + start, n)) return fail("write failed");
+        flushed_ += n;
+    }
+    return true;
+}
+
+// ---- decoder
+
+bool GzipInflater::parseHeaderByte(uint8_t b) {
+    // Fixed 10 bytes: 1f 8b 08 FLG MTIME(4) XFL OS, then optional fields
+    if (hdrCount_ < 10) {
+        if ((hdrCount_ == 0 && b != 0x1F) || (hdrCount_ == 1 && b != 0x8B)) return fail("not gzip");
+        if (hdrCount_ == 2 && b != 8) return fail("not deflate");
+        if (hdrCount_ == 3) hdrFlags_ = b;
+        hdrCount_++;
+        if (hdrCount_ == 10 && !(hdrFlags_ & FEXTRA)) hdrCount_ = 12;
+        return true;
+    }
+    if (hdrFlags_ & FEXTRA) {
+        if (hdrCount_ == 10) { hdrExtra_ = b; hdrCount_++; return true; }
+        if (hdrCount_ == 11) {
+            hdrExtra_ |= (uint16_t)b << 8;
+            hdrCount_++;
+        } else {
+            hdrExtra_--;
+        }
+        if (hdrExtra_ == 0) hdrFlags_ &= ~FEXTRA;
+        return true;
+    }
+    if (hdrFlags_ & FNAME) {
+        if (b == 0) hdrFlags_ &= ~FNAME;
+        return true;
+    }
+    if (hdrFlags_ & FCOMMENT) {
+        if (b == 0) hdrFlags_ &= ~FCOMMENT;
+        return true;
+    }
+    if (hdrFlags_ & FHCRC) {
+        if (++hdrExtra_ == 2) hdrFlags_ &= ~FHCRC;
+        return true;
+    }
+    return true;
+}
+
+bool GzipInflater::dynamicTables() {
+    uint8_t lengths[320];
+    int nlen = bits(5) + 257;
+    int ndist = bits(5) + 1;
+    int ncode = bits(4) + 4;
+    if (nlen > 286 || ndist > 30) return fail("bad table counts");
+
+    for (int i = 0; i < 19; i++) lengths[CLEN_ORDER[i]] = i < ncode ? bits(3) : 0;
+    if (build(*lencode_, lengths, 19) != 0) return fail("bad code lengths");
+
+    int index = 0;
+    while (index < nlen + ndist) {
+        int sym = decode(*lencode_);
+        if (sym < 0) return fail("bad code length symbol");
+        if (sym < 16) {
+            lengths[index++] = sym;
+            continue;
+        }
+        uint8_t len = 0;
+        int repeat;
+        if (sym == 16) {
+            if (index == 0) return fail("repeat with no length");
+            len = lengths[index - 1];
+            repeat = 3 + bits(2);
+        } else if (sym == 17) {
+            repeat = 3 + bits(3);
+        } else {
+            repeat = 11 + bits(7);
+        }
+        if (index + repeat > nlen + ndist) return fail("too many lengths");
+        while (repeat--) lengths[index++] = len;
+    }
+    if (state_ == ST_ERROR) return false;
+    if (lengths[256] == 0) return fail("no end-of-block code");
+
+    int err = build(*lencode_, lengths, nlen);
+    if (err < 0 || (err > 0 && nlen - lencode_->count[0] != 1)) return fail("bad literal/length code");
+    err = build(*distcode_, lengths + nlen, ndist);
+    if (err < 0 || (err > 0 && ndist - distcode_->count[0] != 1)) return fail("bad distance code");
+    return true;
+}
+
+bool GzipInflater::blockHeader() {
+    lastBlock_ = bits(1);
+    uint8_t type = bits(2);
+    if (type == 0) {
+        // Stored: skip to the byte boundary (needBits loads a byte at a time,
+        // so what's left in the bit buffer is exactly the padding)
+        bitBuf_ = 0;
+        bitCnt_ = 0;
+        state_ = ST_STORED_LEN;
+    } else if (type == 1) {
+        uint8_t lengths[288 + 30];
+        int s = 0;
+        for (; s < 144; s++) lengths[s] = 8;
+        for (; s < 256; s++) lengths[s] = 9;
+        for (; s < 280; s++) lengths[s] = 7;
+        for (; s < 288; s++) lengths[s] = 8;
+        for (; s < 288 + 30; s++) lengths[s] = 5;
+        build(*lencode_, lengths, 288);
+        build(*distcode_, lengths + 288, 30);
+        state_ = ST_CODES;
+    } else if (type == 2) {
+        if (!dynamicTables()) return false;
+        state_ = ST_CODES;
+    } else {
+        return fail("bad block type");
+    }
+    return state_ != ST_ERROR;
+}
+
+bool GzipInflater::codes(bool lastInput) {
+    while (lastInput || avail() + bitCnt_ / 8 >= NEED_SYMBOL) {
+        if (wpos_ - flushed_ >= OTA_FLUSH_CHUNK && !flush()) return false;
+
+        int sym = decode(*lencode_);
+        if (sym < 0) return fail("bad literal/length");
+        if (sym < 256) {
+            put((uint8_t)sym);
+            continue;
+        }
+        if (sym == 256) {
+            state_ = lastBlock_ ? ST_TRAILER : ST_BLOCK;
+            if (lastBlock_) { bitBuf_ = 0; bitCnt_ = 0; }  // trailer is byte aligned
+            return true;
+        }
+        sym -= 257;
+        if (sym >= 29) return fail("bad length symbol");
+        uint32_t len = LEN_BASE[sym] + bits(LEN_EXTRA[sym]);
+        int dsym = decode(*distcode_);
+        if (dsym < 0 || dsym >= 30) return fail("bad distance symbol");
+        uint32_t dist = DIST_BASE[dsym] + bits(DIST_EXTRA[dsym]);
+        if (state_ == ST_ERROR) return false;
+        if (dist > total_ || dist > OTA_WINDOW_SIZE) return fail("distance too far back");
+        // Flush first if the copy could overrun bytes not yet written out
+        if (wpos_ - flushed_ + len > OTA_WINDOW_SIZE - 258 && !flush()) return false;
+        while (len--) put(window_[(wpos_ - dist) & OTA_WINDOW_MASK]);
+    }
+    return true;
+}
+
+bool GzipInflater::run(bool lastInput) {
+    for (;;) {
+        switch (state_) {
+            case ST_GZ_HEADER:
+                // Header ends when all flagged optional fields are consumed
+                while (state_ == ST_GZ_HEADER) {
+                    if (hdrCount_ >= 12 && !(hdrFlags_ & (FEXTRA | FNAME | FCOMMENT | FHCRC))) {
+                        state_ = ST_BLOCK;
+                        break;
+                    }
+                    if (avail() == 0) return true;
+                    if (!parseHeaderByte(in_[inPos_++])) return false;
+                }
+                break;
+
+            case ST_BLOCK:
+                if (!lastInput && avail() < NEED_BLOCK_HEADER) return true;
+                if (!blockHeader()) return false;
+                break;
+
+            case ST_STORED_LEN: {
+                if (avail() < 4) {
+                    if (lastInput) return fail("truncated stream");
+                    return true;
+                }
+                uint16_t len = in_[inPos_] | (in_[inPos_ + 1] << 8);
+                uint16_t nlen = in_[inPos_ + 2] | (in_[inPos_ + 3] << 8);
+                inPos_ += 4;
+                if ((uint16_t)~nlen != len) return fail("stored length mismatch");
+                storedLeft_ = len;
+                state_ = ST_STORED;
+                break;
+            }
+
+            case ST_STORED:
+                while (storedLeft_ > 0) {
+                    if (avail() == 0) {
+                        if (lastInput) return fail("truncated stream");
+                        return true;
+                    }
+                    if (wpos_ - flushed_ >= OTA_FLUSH_CHUNK && !flush()) return false;
+                    put(in_[inPos_++]);
+                    storedLeft_--;
+                }
+                state_ = lastBlock_ ? ST_TRAILER : ST_BLOCK;
+                break;
+
+            case ST_CODES:
+                if (!codes(lastInput)) return false;
+                if (state_ == ST_CODES) return true;  // wait for more input
+                break;
+
+            case ST_TRAILER:
+                while (trailerLen_ < 8) {
+                    if (avail() == 0) {
+                        if (lastInput) return fail("truncated trailer");
+                        return true;
+                    }
+                    trailer_[trailerLen_++] = in_[inPos_++];
+                }
+                if (!flush()) return false;
+                {
+                    uint32_t crc = trailer_[0] | (trailer_[1] << 8) | (trailer_[2] << 16) | ((uint32_t)trailer_[3] << 24);
+                    uint32_t size = trailer_[4] | (trailer_[5] << 8) | (trailer_[6] << 16) | ((uint32_t)trailer_[7] << 24);
+                    if (crc != crc_) return fail("gzip CRC mismatch");
+                    if (size != total_) return fail("gzip size mismatch");
+                }
+                state_ = ST_DONE;
+                break;
+
+            case ST_DONE:
+                inPos_ = inEnd_;  // ignore anything after the member
+                return true;
+
+            default:
+                return false;
+        }
+    }
+}
+
+// =============================================================
+// SHA-256
+// =============================================================
+
+static const uint32_t SHA_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+
+static inline uint32_t ror(uint32_t x, uint8_t n) { return (x >> n) | (x << (32 - n)); }
+
+void Sha256::begin() {
+    static const uint32_t H0[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    memcpy(h_, H0, sizeof(h_));
+    bytes_ = 0;
+    used_ = 0;
+}
+
+void Sha256::block(const uint8_t* p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) w[i] = (uint32_t)p[4 * i] << 24 | p[4 * i + 1] << 16 | p[4 * i + 2] << 8 | p[4 * i + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = h_[0], b = h_[1], c = h_[2], d = h_[3], e = h_[4], f = h_[5], g = h_[6], h = h_[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + SHA_K[i] + w[i];
+        uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    h_[0] += a; h_[1] += b; h_[2] += c; h_[3] += d;
+    h_[4] += e; h_[5] += f; h_[6] += g; h_[7] += h;
+}
+
+void Sha256::update(const uint8_t* data, size_t len) {
+    bytes_ += len;
+    while (len > 0) {
+        size_t n = 64 - used_;
+        if (n > len) n = len;
+        memcpy(buf_ + used_, data, n);
+        used_ += n;
+        data += n;
+        len -= n;
+        if (used_ == 64) {
+            block(buf_);
+            used_ = 0;
+        }
+    }
+}
+
+void Sha256::finish(uint8_t out[32]) {
+    uint64_t bitLen = bytes_ * 8;
+    uint8_t pad = 0x80;
+    update(&pad, 1);
+    pad = 0;
+    while (used_ != 56) update(&pad, 1);
+    uint8_t lenBytes[8];
+    for (int i = 0; i < 8; i++) lenBytes[i] = bitLen >> (56 - 8 * i);
+    update(lenBytes, 8);
+    for (int i = 0; i < 8; i++) {
+        out[4 * i] = h_[i] >> 24;
+        out[4 * i + 1] = h_[i] >> 16;
+        out[4 * i + 2] = h_[i] >> 8;
+        out[4 * i + 3] = h_[i];
+    }
+}
+
+bool parseSha256Hex(const char* hex, uint8_t out[32]) {
+    if (hex == NULL || strlen(hex) != 64) return false;
+    for (int i = 0; i < 64; i++) {
+        char c = hex[i];
+        uint8_t v;
+        if (c >= '0' && c <= '9') v = c - '0';
+        else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+        else return false;
+        if (i & 1) out[i / 2] |= v;
+        else out[i / 2] = v << 4;
+    }
+    return true;
+}
+
+// =============================================================
+// OtaStream
+// =============================================================
+
+bool OtaStream::fail(const char* msg) {
+    if (!error_) error_ = msg;
+    abort();
+    return false;
+}
+
+bool OtaStream::begin(PartitionWriter* target, const uint8_t* expectedSha256) {
+    target_ = target;
+    verify_ = expectedSha256 != NULL;
+    if (verify_) memcpy(expected_, expectedSha256, 32);
+    started_ = false;
+    haveFirst_ = false;
+    stats_.bytesIn = 0;
+    stats_.bytesOut = 0;
+    stats_.gzip = false;
+    error_ = NULL;
+    sha_.begin();
+    active_ = target_->begin();
+    if (!active_) error_ = target_->error();
+    return active_;
+}
+
+bool OtaStream::sinkThunk(void* ctx, const uint8_t* data, size_t len) {
+    return ((OtaStream*)ctx)->emit(data, len);
+}
+
+bool OtaStream::emit(const uint8_t* data, size_t len) {
+    sha_.update(data, len);
+    stats_.bytesOut += len;
+    if (!target_->write(data, len)) {
+        error_ = target_->error();
+        return false;
+    }
+    return true;
+}
+
+// The format is decided by the first two bytes (gzip magic 1f 8b); HTTP may
+// deliver them in separate chunks, so the first one is held back.
+bool OtaStream::write(const uint8_t* data, size_t len) {
+    if (!active_) return false;
+    stats_.bytesIn += len;
+    if (!started_) {
+        if (len == 0) return true;
+        if (!haveFirst_) {
+            first_ = data[0];
+            haveFirst_ = true;
+            data++;
+            len--;
+            if (len == 0) return true;
+        }
+        stats_.gzip = first_ == 0x1F && data[0] == 0x8B;
+        started_ = true;
+        if (stats_.gzip) {
+            if (!inflater_.begin(sinkThunk, this)) return fail(inflater_.error());
+            if (!inflater_.feed(&first_, 1)) return fail(inflater_.error());
+        } else if (!emit(&first_, 1)) {
+            return fail("write failed");
+        }
+    }
+    bool ok = stats_.gzip ? inflater_.feed(data, len) : emit(data, len);
+    if (!ok) return fail(stats_.gzip ? inflater_.error() : "write failed");
+    return true;
+}
+
+bool OtaStream::end() {
+    if (!active_) return false;
+    if (!started_) {
+        if (!haveFirst_) return fail("empty image");
+        started_ = true;  // single-byte raw image
+        if (!emit(&first_, 1)) return fail("write failed");
+    }
+    if (stats_.gzip) {
+        bool ok = inflater_.finish();
+        if (!ok) return fail(inflater_.error());
+        inflater_.end();
+    }
+    sha_.finish(actual_);
+    if (verify_ && memcmp(actual_, expected_, 32) != 0) return fail("sha256 mismatch");
+    if (!target_->commit()) return fail(target_->error());
+    active_ = false;
+    return true;
+}
+
+void OtaStream::abort() {
+    if (stats_.gzip && started_) inflater_.end();
+    if (active_) target_->abort();
+    active_ = false;
+}
+
+void OtaStream::digest(uint8_t out[32]) const {
+    memcpy(out, actual_, 32);
+}
@@ -0,0 +1,144 @@
+#ifndef OTA_STREAM_H
+#define OTA_STREAM_H
+
+// Streaming OTA core: takes the upload in whatever chunk sizes the HTTP
+// server hands over, inflates gzip on the fly (raw images pass through),
+// hashes the decompressed image and writes it to a PartitionWriter.
+//
+// No Arduino dependencies, so the same code runs on the host against a
+// file-backed partition (see examples/ota_host.cpp). RAM is bounded: the
+// 32 KB inflate window plus ~3 KB of buffers/tables, allocated for the
+// duration of one update only.
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Destination of the decompressed image (inactive app slot, FS partition,
+// or a file on the host).
+class PartitionWriter {
+public:
+    virtual ~PartitionWriter() {}
+    virtual bool begin() = 0;
+    virtual bool write(const uint8_t* data, size_t len) = 0;
+    virtual bool commit() = 0;   // image verified: make it the active one
+    virtual void abort() = 0;
+    virtual const char* error() = 0;
+};
+
+class Sha256 {
+public:
+    void begin();
+    void update(const uint8_t* data, size_t len);
+    void finish(uint8_t out[32]);
+
+private:
+    void block(const uint8_t* p);
+    uint32_t h_[8];
+    uint64_t bytes_;
+    uint8_t buf_[64];
+    uint8_t used_;
+};
+
+// Resumable gzip (RFC 1952 / 1951) decoder. feed() accepts any chunk size;
+// decoded bytes go to the sink in runs of up to OTA_FLUSH_CHUNK.
+class GzipInflater {
+public:
+    typedef bool (*Sink)(void* ctx, const uint8_t* data, size_t len);
+
+    bool begin(Sink sink, void* ctx);
+    bool feed(const uint8_t* data, size_t len);
+    bool finish();               // no more input: drain and check CRC32/ISIZE
+    void end();                  // releases the window
+    const char* error() const { return error_; }
+
+private:
+    struct Huffman {
+        uint16_t count[16];
+        uint16_t symbol[288];
+    };
+
+    bool run(bool lastInput);
+    bool parseHeaderByte(uint8_t b);
+    bool blockHeader();
+    bool dynamicTables();
+    bool codes(bool lastInput);
+    bool fail(const char* msg);
+
+    bool needBits(uint8_t n);
+    uint32_t bits(uint8_t n);
+    int decode(const Huffman& h);
+    static int build(Huffman& h, const uint8_t* lengths, int n);
+
+    void put(uint8_t b);
+    bool flush();
+
+    size_t avail() const { return inEnd_ - inPos_; }
+
+    Sink sink_;
+    void* ctx_;
+    uint8_t* window_;            // OTA_WINDOW_SIZE, circular
+    uint32_t wpos_;
+    uint32_t flushed_;
+    uint32_t total_;
+    uint32_t crc_;
+
+    uint8_t* in_;                // OTA_INPUT_SIZE
+    size_t inPos_, inEnd_;
+    uint32_t bitBuf_;
+    uint8_t bitCnt_;
+
+    uint8_t state_;
+    uint8_t hdrFlags_;
+    uint16_t hdrCount_;
+    uint16_t hdrExtra_;
+    bool lastBlock_;
+    uint32_t storedLeft_;
+    uint8_t trailer_[8];
+    uint8_t trailerLen_;
+
+    Huffman* lencode_;
+    Huffman* distcode_;
+    const char* error_;
+};
+
+struct OtaStats {
+    uint32_t bytesIn;            // as uploaded
+    uint32_t bytesOut;           // written to the partition
+    bool gzip;
+};
+
+class OtaStream {
+public:
+    // expectedSha256 may be NULL (no verification, not recommended)
+    bool begin(PartitionWriter* target, const uint8_t* expectedSha256);
+    bool write(const uint8_t* data, size_t len);
+    bool end();                  // finish, verify, commit
+    void abort();
+
+    const char* error() const { return error_; }
+    const OtaStats& stats() const { return stats_; }
+    void digest(uint8_t out[32]) const;
+
+private:
+    static bool sinkThunk(void* ctx, const uint8_t* data, size_t len);
+    bool emit(const uint8_t* data, size_t len);
+    bool fail(const char* msg);
+
+    PartitionWriter* target_;
+    GzipInflater inflater_;
+    Sha256 sha_;
+    uint8_t expected_[32];
+    uint8_t actual_[32];
+    bool verify_;
+    bool started_;               // format detected
+    bool active_;
+    uint8_t first_;              // first byte, held until the second arrives
+    bool haveFirst_;
+    OtaStats stats_;
+    const char* error_;
+};
+
+// "a3f1..." (64 hex chars) -> 32 bytes
+bool parseSha256Hex(const char* hex, uint8_t out[32]);
+
+#endif
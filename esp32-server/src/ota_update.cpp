@@ -0,0 +1,125 @@
+#include "ota_update.h"
+#include "ota_stream.h"
+#include <Update.h>
+#include "storage.h"
+
+// Update.begin() with an unknown size takes the whole target partition
+class UpdatePartition : public PartitionWriter {
+public:
+    int command = U_FLASH;
+
+    bool begin() override { return Update.begin(UPDATE_SIZE_UNKNOWN, command); }
+    bool write(const uint8_t* data, size_t len) override {
+        return Update.write((uint8_t*)data, len) == len;
+    }
+    // end(true): accept however many bytes were written; for U_FLASH this is
+    // what marks the new slot bootable
+    bool commit() override { return Update.end(true); }
+    void abort() override { Update.abort(); }
+    const char* error() override { return Update.errorString(); }
+};
+
+enum OtaState {
+    OTA_IDLE = 0,
+    OTA_RECEIVING,
+    OTA_DONE,
+    OTA_FAILED
+};
+
+static const char* STATE_NAMES[] = { "idle", "receiving", "done", "failed" };
+
+static UpdatePartition partition;
+static OtaStream stream;
+static OtaState state = OTA_IDLE;
+static OtaTarget target = OTA_FIRMWARE;
+static String lastError = "";
+static uint32_t startMs = 0;
+static uint32_t elapsedMs = 0;
+static uint32_t rebootAt = 0;
+
+static bool fail(const char* msg) {
+    lastError = msg ? msg : "unknown";
+    bool wasReceiving = state == OTA_RECEIVING;
+    state = OTA_FAILED;
+    elapsedMs = millis() - startMs;
+    Serial.println("OTA: FAILED: " + lastError);
+    // No spare slot for the filesystem: it was unmounted and written in place
+    if (wasReceiving && target == OTA_FILESYSTEM) storageResume(stream.stats().bytesOut == 0);
+    return false;
+}
+
+bool otaBegin(OtaTarget t, const char* sha256Hex) {
+    if (state == OTA_RECEIVING) {  // previous upload never finished
+        stream.abort();
+        fail("superseded by a new upload");
+    }
+    target = t;
+    lastError = "";
+    startMs = millis();
+    elapsedMs = 0;
+
+    uint8_t expected[32];
+    if (!parseSha256Hex(sha256Hex, expected)) return fail("sha256 (64 hex chars) required");
+
+    partition.command = t == OTA_FILESYSTEM ? U_SPIFFS : U_FLASH;
+    if (t == OTA_FILESYSTEM) {
+        // Still mounting on the storage task; can't unmount under it
+        if (!storageReady() && !storageFailed()) return fail("storage still starting");
+        storageSuspend();  // about to be overwritten; the reboot remounts it
+    }
+
+    state = OTA_RECEIVING;
+    if (!stream.begin(&partition, expected)) return fail(stream.error());
+    Serial.println(String("OTA: RECEIVING ") + (t == OTA_FILESYSTEM ? "FILESYSTEM" : "FIRMWARE"));
+    return true;
+}
+
+bool otaWrite(const uint8_t* data, size_t len) {
+    if (state != OTA_RECEIVING) return false;
+    if (!stream.write(data, len)) return fail(stream.error());
+    return true;
+}
+
+bool otaEnd() {
+    if (state != OTA_RECEIVING) return false;
+    if (!stream.end()) return fail(stream.error());
+    state = OTA_DONE;
+    elapsedMs = millis() - startMs;
+    rebootAt = millis() + OTA_REBOOT_DELAY_MS;
+    const OtaStats& s = stream.stats();
+    Serial.println("OTA: VERIFIED " + String(s.bytesOut) + " BYTES IN " + String(elapsedMs) + " MS, REBOOTING");
+    return true;
+}
+
+void otaAbort() {
+    if (state != OTA_RECEIVING) return;
+    stream.abort();
+    fail("upload aborted");
+}
+
+bool otaSucceeded() { return state == OTA_DONE; }
+const char* otaError() { return lastError.c_str(); }
+
+void serviceOta() {
+    if (state == OTA_DONE && (int32_t)(millis() - rebootAt) >= 0) {
+        ESP.restart();
+    }
+}
+
+void otaToJson(JsonDocument& doc) {
+    JsonObject ota = doc["ota"].to<JsonObject>();
+    ota["state"] = STATE_NAMES[state];
+    if (state == OTA_IDLE) return;
+
+    const OtaStats& s = stream.stats();
+    uint32_t ms = state == OTA_RECEIVING ? millis() - startMs : elapsedMs;
+    ota["target"] = target == OTA_FILESYSTEM ? "filesystem" : "firmware";
+    ota["format"] = s.gzip ? "gzip" : "raw";
+    ota["bytesIn"] = s.bytesIn;
+    ota["bytesOut"] = s.bytesOut;
+    ota["elapsedMs"] = ms;
+    // KB/s of upload and of flash writes (differ by the compression ratio)
+    ota["inKBps"] = ms ? round(s.bytesIn / 1.024 / ms * 10) / 10.0 : 0;
+    ota["outKBps"] = ms ? round(s.bytesOut / 1.024 / ms * 10) / 10.0 : 0;
+    if (state == OTA_FAILED) ota["error"] = lastError;
+}
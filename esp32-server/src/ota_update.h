@@ -0,0 +1,37 @@
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// POST /ota glue: feeds WebServer upload chunks through OtaStream into the
+// inactive app slot (or the LittleFS partition) via the Update library.
+// The slot is only switched after the decompressed image's SHA-256 matches;
+// the board restarts shortly after a successful update.
+// There is no spare slot for the filesystem: a filesystem update unmounts
+// LittleFS and writes over it. If it fails after the first write, file
+// routes answer 503 "Storage Failed" until a good image is uploaded.
+
+#define OTA_REBOOT_DELAY_MS  1000   // let the HTTP response get out first
+
+enum OtaTarget {
+    OTA_FIRMWARE = 0,
+    OTA_FILESYSTEM
+};
+
+// Upload lifecycle, called from the upload callback
+bool otaBegin(OtaTarget target, const char* sha256Hex);
+bool otaWrite(const uint8_t* data, size_t len);
+bool otaEnd();
+void otaAbort();
+
+bool otaSucceeded();        // last update finished and committed
+const char* otaError();     // last failure, "" if none
+
+// Restarts the board once a committed update's response has gone out
+void serviceOta();
+
+// State + throughput of the current/last update
+void otaToJson(JsonDocument& doc);
+
+#endif
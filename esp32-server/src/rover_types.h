@@ -0,0 +1,106 @@
+#ifndef ROVER_TYPES_H
+#define ROVER_TYPES_H
+
+#include <stdint.h>
+#include "galileo_nav/events.h"   // NavEvent + shared names (build_flags: -I ../layer-c-galileo)
+
+// Rover events: what /detect, /event and the Galileo link trigger, and what
+// the voice client receives from GET /event. Names are the voice-side
+// spelling (audio_map.json categories); HTTP parsing is case-insensitive so
+// "saw_human" and "SAW_HUMAN" are the same event.
+// X(id, name)
+#define ROVER_EVENT_LIST(X) \
+    X(SAW_HUMAN,       "SAW_HUMAN") \
+    X(COLLISION,       EVENT_COLLISION) \
+    X(STUCK,           EVENT_STUCK) \
+    X(RANDOM,          "RANDOM") \
+    X(STOP,            "STOP") \
+    X(BOOT,            EVENT_BOOT) \
+    X(MOVING_FORWARD,  "MOVING_FORWARD") \
+    X(MOVING_BACKWARD, "MOVING_BACKWARD") \
+    X(TURNING_LEFT,    "TURNING_LEFT") \
+    X(TURNING_RIGHT,   "TURNING_RIGHT") \
+    X(SAY,             "SAY")              /* "SAY:<file.mp3>", payload kept separately */
+
+enum RoverEvent : uint8_t {
+    EVT_NONE = 0,
+#define ROVER_EVENT_ENUM(id, name) EVT_##id,
+    ROVER_EVENT_LIST(ROVER_EVENT_ENUM)
+#undef ROVER_EVENT_ENUM
+    EVT_COUNT
+};
+
+static constexpr const char* ROVER_EVENT_NAMES[EVT_COUNT] = {
+    "",
+#define ROVER_EVENT_NAME(id, name) name,
+    ROVER_EVENT_LIST(ROVER_EVENT_NAME)
+#undef ROVER_EVENT_NAME
+};
+
+// X(id, name)
+#define ROVER_MODE_LIST(X) \
+    X(AUTO,   "AUTO") \
+    X(MANUAL, "MANUAL")
+
+enum RoverMode : uint8_t {
+#define ROVER_MODE_ENUM(id, name) MODE_##id,
+    ROVER_MODE_LIST(ROVER_MODE_ENUM)
+#undef ROVER_MODE_ENUM
+    MODE_COUNT,
+    MODE_INVALID = MODE_COUNT
+};
+
+static constexpr const char* ROVER_MODE_NAMES[MODE_COUNT] = {
+#define ROVER_MODE_NAME(id, name) name,
+    ROVER_MODE_LIST(ROVER_MODE_NAME)
+#undef ROVER_MODE_NAME
+};
+
+constexpr char upperAscii(char c) {
+    return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+}
+
+// Case-insensitive match of `s` against the upper-case table name `name`.
+// With stopAt = ':' the match also accepts "NAME:<payload>".
+constexpr bool nameMatches(const char* s, const char* name, char stopAt) {
+    return *name == '\0' ? (*s == '\0' || (stopAt != '\0' && *s == stopAt))
+         : upperAscii(*s) == *name && nameMatches(s + 1, name + 1, stopAt);
+}
+
+constexpr RoverEvent roverEventFromNameAt(const char* s, uint8_t i) {
+    return i >= EVT_COUNT ? EVT_NONE
+         : nameMatches(s, ROVER_EVENT_NAMES[i], i == EVT_SAY ? ':' : '\0') ? (RoverEvent)i
+         : roverEventFromNameAt(s, i + 1);
+}
+
+// Parsed once at the HTTP boundary. "bazinga" is the README's name for RANDOM.
+constexpr RoverEvent roverEventFromName(const char* s) {
+    return (s == nullptr || *s == '\0') ? EVT_NONE
+         : nameMatches(s, "BAZINGA", '\0') ? EVT_RANDOM
+         : roverEventFromNameAt(s, 1);
+}
+
+constexpr const char* roverEventName(RoverEvent e) {
+    return e < EVT_COUNT ? ROVER_EVENT_NAMES[e] : "";
+}
+
+constexpr RoverMode roverModeFromNameAt(const char* s, uint8_t i) {
+    return i >= MODE_COUNT ? MODE_INVALID
+         : nameMatches(s, ROVER_MODE_NAMES[i], '\0') ? (RoverMode)i
+         : roverModeFromNameAt(s, i + 1);
+}
+
+constexpr RoverMode roverModeFromName(const char* s) {
+    return s == nullptr ? MODE_INVALID : roverModeFromNameAt(s, 0);
+}
+
+constexpr const char* roverModeName(RoverMode m) {
+    return m < MODE_COUNT ? ROVER_MODE_NAMES[m] : "";
+}
+
+static_assert(roverEventFromName("saw_human") == EVT_SAW_HUMAN, "RoverEvent name table out of sync");
+static_assert(roverEventFromName("SAY:random_1.mp3") == EVT_SAY, "RoverEvent name table out of sync");
+static_assert(roverEventFromName("COLLISION") == EVT_COLLISION, "RoverEvent name table out of sync");
+static_assert(roverModeFromName("manual") == MODE_MANUAL, "RoverMode name table out of sync");
+
+#endif
@@ -0,0 +1,238 @@
+#include "storage.h"
+#include "clip_archive.h"
+#include "boot_timeline.h"
+#include "loop_wait.h"
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static AssetEntry assets[ASSET_MAX];
+static uint8_t numAssets = 0;
+static char categories[ASSET_CAT_MAX][ASSET_CAT_NAME];
+static uint8_t numCategories = 0;
+
+static volatile bool ready = false;
+static volatile bool failed = false;
+
+// Packed archive: one handle for as long as the rover is up
+class LittleFsSource : public ClipSource {
+public:
+    File file;
+    uint32_t size() override { return file.size(); }
+    bool readAt(uint32_t offset, void* buf, size_t len) override {
+        return file.seek(offset) && file.read((uint8_t*)buf, len) == len;
+    }
+};
+
+static LittleFsSource archiveSource;
+static ClipArchive archive;
+static bool packed = false;
+
+// Loose clips: the last one read stays open
+static File looseFile;
+static int looseIndex = -1;
+
+static bool endsWith(const char* s, const char* suffix) {
+    size_t n = strlen(s), m = strlen(suffix);
+    return n >= m && strcasecmp(s + n - m, suffix) == 0;
+}
+
+// The archive's index instead of a directory walk
+static bool indexArchive() {
+    if (!LittleFS.exists(ARCHIVE_PATH)) return false;
+    archiveSource.file = LittleFS.open(ARCHIVE_PATH, "r");
+    if (!archiveSource.file || !archive.open(&archiveSource)) {
+        Serial.printf("%s unusable (%s), using loose clips\n", ARCHIVE_PATH, archive.error());
+        archiveSource.file.close();
+        return false;
+    }
+    char name[CLIP_CATEGORY_SIZE + 1];
+    for (uint8_t c = 0; c < archive.categoryCount() && numCategories < ASSET_CAT_MAX; c++) {
+        if (!archive.category(c, name)) break;
+        strncpy(categories[numCategories], name, ASSET_CAT_NAME - 1);
+        categories[numCategories][ASSET_CAT_NAME - 1] = '\0';
+        numCategories++;
+    }
+    ClipEntry e;
+    for (uint16_t i = 0; i < archive.clipCount() && numAssets < ASSET_MAX; i++) {
+        if (!archive.entry(i, e)) break;
+        if (e.category >= numCategories) continue;
+        AssetEntry& a = assets[numAssets++];
+        snprintf(a.path, ASSET_PATH_MAX, "/%s/%s", categories[e.category], e.name);
+        a.category = e.category;
+        a.size = e.length;
+        a.offset = e.offset;
+        a.codec = e.codec;
+        a.durationMs = e.durationMs;
+        a.peakDb = a.rmsDb = ASSET_LEVEL_UNKNOWN;
+    }
+    if (!archive.isOpen()) {
+        Serial.printf("%s unusable (%s), using loose clips\n", ARCHIVE_PATH, archive.error());
+        archiveSource.file.close();
+        numAssets = numCategories = 0;
+        return false;
+    }
+    return true;
+}
+
+// One pass over /<CATEGORY>/*.mp3. Everything else (html, json) is served by path.
+static void indexAssets() {
+    packed = indexArchive();
+    if (packed) return;
+    File root = LittleFS.open("/");
+    if (!root) return;
+    for (File dir = root.openNextFile(); dir; dir = root.openNextFile()) {
+        if (!dir.isDirectory()) continue;
+        if (numCategories >= ASSET_CAT_MAX) break;
+        uint8_t cat = numCategories++;
+        strncpy(categories[cat], dir.name(), ASSET_CAT_NAME - 1);
+        categories[cat][ASSET_CAT_NAME - 1] = '\0';
+
+        for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+            if (f.isDirectory() || !endsWith(f.name(), ".mp3")) continue;
+            if (numAssets >= ASSET_MAX) break;
+            AssetEntry& a = assets[numAssets];
+            snprintf(a.path, ASSET_PATH_MAX, "/%s/%s", categories[cat], f.name());
+            a.category = cat;
+            a.size = f.size();
+            a.offset = ASSET_LOOSE;
+            a.codec = CLIP_CODEC_MP3;
+            a.durationMs = 0;
+            a.peakDb = a.rmsDb = ASSET_LEVEL_UNKNOWN;
+            numAssets++;
+        }
+    }
+}
+
+static void storageTask(void*) {
+    // Mount first without formatting: a blank/corrupt partition is formatted
+    // only after a failed mount, which is the slow path.
+    bool ok = LittleFS.begin(false);
+    if (!ok) {
+        bootMark("fs_format");
+        ok = LittleFS.begin(true);
+    }
+    if (ok) {
+        bootMark("fs_mounted");
+        indexAssets();
+        bootMark("assets_indexed");
+        Serial.println("LittleFS Mounted: OK (" + String(numAssets) + (packed ? " packed clips)" : " clips)"));
+        ready = true;
+        wakeLoop();  // loop() loads files that were waiting on storage
+    } else {
+        Serial.println("!!! LittleFS Mount Failed !!!");
+        bootMark("fs_failed");
+        failed = true;
+    }
+    vTaskDelete(NULL);
+}
+
+void startStorage() {
+    // Core 0 alongside the WiFi stack; setup() continues on core 1
+    xTaskCreatePinnedToCore(storageTask, "storage", 4096, NULL, 1, NULL, 0);
+}
+
+bool storageReady() { return ready; }
+bool storageFailed() { return failed; }
+
+void storageSuspend() {
+    ready = false;
+    archiveSource.file.close();
+    looseFile.close();
+    looseIndex = -1;
+    packed = false;
+    numAssets = numCategories = 0;
+    LittleFS.end();
+}
+
+void storageResume(bool intact) {
+    // A partly written image can still mount and hand out garbage
+    if (!intact || !LittleFS.begin(false)) {
+        Serial.println("!!! LittleFS Left Unusable, Upload A Filesystem Image !!!");
+        failed = true;
+        return;
+    }
+    indexAssets();
+    ready = true;
+    loadAssetMeta();
+    Serial.println("LittleFS Remounted: OK (" + String(numAssets) + (packed ? " packed clips)" : " clips)"));
+}
+
+uint8_t assetCount() { return ready ? numAssets : 0; }
+const AssetEntry& assetAt(uint8_t i) { return assets[i]; }
+uint8_t assetCategoryCount() { return ready ? numCategories : 0; }
+const char* assetCategory(uint8_t c) { return categories[c]; }
+
+int findAsset(const char* path) {
+    for (uint8_t i = 0; i < assetCount(); i++) {
+        if (strcmp(assets[i].path, path) == 0) return i;
+    }
+    return -1;
+}
+
+int findCategory(const char* name) {
+    for (uint8_t c = 0; c < assetCategoryCount(); c++) {
+        if (strcasecmp(categories[c], name) == 0) return c;
+    }
+    return -1;
+}
+
+bool assetsPacked() { return packed; }
+
+const char* assetContentType(uint8_t i) {
+    return assets[i].codec == CLIP_CODEC_WAV ? "audio/wav" : "audio/mpeg";
+}
+
+static int8_t levelDb(JsonVariantConst v) {
+    if (!v.is<float>()) return ASSET_LEVEL_UNKNOWN;
+    float db = v.as<float>();
+    return db > 0 ? 0 : db < -127 ? -127 : (int8_t)lroundf(db);
+}
+
+// { "COLLISION": [ {"file": "collision_1.mp3", "ms": 2403, "peak": -0.4, "rms": -17.9}, ... ] }
+void loadAssetMeta() {
+    File f = LittleFS.open(AUDIO_MAP_PATH, "r");
+    if (!f) return;
+    String json = f.readString();
+    f.close();
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, json);
+    if (err) {
+        Serial.printf("%s: %s\n", AUDIO_MAP_PATH, err.c_str());
+        return;
+    }
+    char path[ASSET_PATH_MAX];
+    uint8_t filled = 0;
+    for (JsonPair kv : doc.as<JsonObject>()) {
+        for (JsonObject clip : kv.value().as<JsonArray>()) {
+            snprintf(path, sizeof(path), "/%s/%s", kv.key().c_str(), clip["file"] | "");
+            int i = findAsset(path);
+            if (i < 0) continue;
+            AssetEntry& a = assets[i];
+            if (clip["ms"].is<uint32_t>()) a.durationMs = clip["ms"];
+            a.peakDb = levelDb(clip["peak"]);
+            a.rmsDb = levelDb(clip["rms"]);
+            filled++;
+        }
+    }
+    Serial.printf("AUDIO META: %u of %u clips\n", filled, numAssets);
+}
+
+size_t readAsset(uint8_t i, uint32_t pos, uint8_t* buf, size_t len) {
+    if (i >= assetCount()) return 0;
+    const AssetEntry& a = assets[i];
+    if (pos >= a.size) return 0;
+    if (len > a.size - pos) len = a.size - pos;
+    if (a.offset != ASSET_LOOSE) {
+        return archiveSource.readAt(a.offset + pos, buf, len) ? len : 0;
+    }
+    if (looseIndex != i) {
+        if (looseFile) looseFile.close();
+        looseFile = LittleFS.open(a.path, "r");
+        looseIndex = looseFile ? i : -1;
+        if (!looseFile) return 0;
+    }
+    if (!looseFile.seek(pos)) return 0;
+    return looseFile.read(buf, len);
+}
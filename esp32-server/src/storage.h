@@ -0,0 +1,63 @@
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <Arduino.h>
+
+// LittleFS mount + audio asset index, run on a background task so WiFi and
+// the HTTP server come up in parallel. Until storageReady() is true, handlers
+// that need files should answer 503 instead of touching LittleFS.
+// Clips come from the packed archive (ARCHIVE_PATH, clip_archive.h) when
+// there is one, otherwise from the /<CATEGORY>/*.mp3 tree. Their length and
+// level come from AUDIO_MAP_PATH (precomputed by scripts/generate_map.py).
+
+#define ASSET_MAX        64
+#define ASSET_PATH_MAX   40
+#define ASSET_CAT_MAX    8
+#define ASSET_CAT_NAME   16
+#define ARCHIVE_PATH     "/clips.sra"
+#define ASSET_LOOSE      0xFFFFFFFF   // AssetEntry::offset of a file of its own
+#define AUDIO_MAP_PATH   "/audio_map.json"
+#define ASSET_LEVEL_UNKNOWN  (-128)
+
+struct AssetEntry {
+    char path[ASSET_PATH_MAX];  // "/COLLISION/collision_1.mp3"
+    uint8_t category;           // index into assetCategory()
+    uint32_t size;
+    uint32_t offset;            // in the archive, or ASSET_LOOSE
+    uint8_t codec;              // CLIP_CODEC_* (clip_archive.h)
+    uint32_t durationMs;        // from the archive index / audio map, 0 if unknown
+    int8_t peakDb;              // dBFS, from the audio map
+    int8_t rmsDb;               // dBFS (loudness), from the audio map
+};
+
+void startStorage();
+bool storageReady();
+bool storageFailed();
+
+// Filesystem OTA: storageSuspend() closes the archive/clip handles and
+// unmounts, so storageReady() is false while the partition is rewritten.
+// storageResume() after a failed update: remounts and reindexes if nothing
+// was written yet, otherwise leaves storage failed until a good image lands.
+// Loop task only.
+void storageSuspend();
+void storageResume(bool intact);
+
+uint8_t assetCount();
+const AssetEntry& assetAt(uint8_t i);
+uint8_t assetCategoryCount();
+const char* assetCategory(uint8_t c);
+int findAsset(const char* path);     // -1 if not indexed
+int findCategory(const char* name);  // -1 if unknown
+bool assetsPacked();                 // served from ARCHIVE_PATH
+const char* assetContentType(uint8_t i);  // "audio/mpeg" or "audio/wav"
+
+// Fills in durations and levels from AUDIO_MAP_PATH. Loop task, once
+// storageReady(); clips it doesn't list keep what the index had.
+void loadAssetMeta();
+
+// Up to len bytes at pos within clip i; fewer at its end, 0 on error.
+// Loop task only: the archive (or the last loose clip) stays open between
+// calls, so streaming a clip in chunks doesn't reopen anything.
+size_t readAsset(uint8_t i, uint32_t pos, uint8_t* buf, size_t len);
+
+#endif
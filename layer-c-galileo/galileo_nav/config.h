@@ -12,10 +12,22 @@
     #include <SoftwareSerial.h>
     #define USE_SOFTWARE_SERIAL
     #define PIN_RX_FROM_ESP  2  // Connect to ESP32 TX
-    #define PIN_TX_TO_ESP    3  // Connect to ESP32 RX
+    #define PIN_TX_TO_ESP    11 // Connect to ESP32 RX
+    // The echo needs an external interrupt and the UNO only has INT0/INT1
+    // (pins 2/3); SoftwareSerial owns every pin-change vector.
+    #define PIN_ULTRASONIC_TRIG  12
+    #define PIN_ULTRASONIC_ECHO  3
+    // ...so the forward sensor is the only one (no ultrasonic array)
+    // No interrupt left for the encoders either: the Timer2 tick samples
+    // them at 9.6 kHz (good for ~4000 ticks/s per wheel)
+    #define PIN_ENC_LEFT_A   A0
+    #define PIN_ENC_LEFT_B   A1
+    #define PIN_ENC_RIGHT_A  A2
+    #define PIN_ENC_RIGHT_B  A3
 #elif defined(ESP32)
     // ESP32 WROOM / DevKit Pinout
     #define ESP_SERIAL Serial // Use USB Serial for output (or Serial2 if communicating with another device)
+    #define LINK_ON_DEBUG_SERIAL  // ESP_SERIAL is also the debug port
     
     // Motor Pins (Use GPIOs safe for output)
     #define PIN_MOTOR_LEFT_FWD   26
@@ -29,6 +41,20 @@
     #define PIN_BUMP_LEFT        14
     #define PIN_BUMP_RIGHT       27
     #define PIN_RESET_BUTTON     0  // BOOT button on board
+
+    // Ultrasonic array besides the forward sensor (5 V echoes need a divider)
+    #define PIN_SONAR_LEFT_TRIG  18
+    #define PIN_SONAR_LEFT_ECHO  19
+    #define PIN_SONAR_RIGHT_TRIG 21
+    #define PIN_SONAR_RIGHT_ECHO 22
+    #define PIN_SONAR_REAR_TRIG  23
+    #define PIN_SONAR_REAR_ECHO  4
+
+    // Wheel encoders (input-only GPIOs, external pull-ups)
+    #define PIN_ENC_LEFT_A       34
+    #define PIN_ENC_LEFT_B       35
+    #define PIN_ENC_RIGHT_A      36
+    #define PIN_ENC_RIGHT_B      39
 #else
     // For Mega/Leonardo/Galileo (Boards with HW Serial1)
     #define ESP_SERIAL Serial1 
@@ -45,14 +71,83 @@
 // --- Sensor Pins (Shared/Fallbacks if not defined above) ---
 #ifndef PIN_ULTRASONIC_TRIG
 #define PIN_ULTRASONIC_TRIG  2
-#define PIN_ULTRASONIC_ECHO  3
+#define PIN_ULTRASONIC_ECHO  3   // must be interrupt capable
+#define PIN_SONAR_LEFT_TRIG  11  // echoes interrupt capable too (any pin on the
+#define PIN_SONAR_LEFT_ECHO  12  // Galileo). Where one isn't (12 on a Mega) that
+#define PIN_SONAR_RIGHT_TRIG 13  // sensor is left out at startup and the map
+                                 // treats its side as unknown, not clear.
+                                 // No pins left for a rear one.
+#define PIN_SONAR_RIGHT_ECHO A4
+#endif
+#ifndef PIN_BUMP_LEFT
 #define PIN_BUMP_LEFT        4
 #define PIN_BUMP_RIGHT       7
 #define PIN_RESET_BUTTON     8
 #endif
+#ifndef PIN_ENC_LEFT_A
+#define PIN_ENC_LEFT_A       A0  // CHANGE interrupts on all four (fine on the Galileo;
+#define PIN_ENC_LEFT_B       A1  // on a Mega pick from 2, 3, 18-21)
+#define PIN_ENC_RIGHT_A      A2
+#define PIN_ENC_RIGHT_B      A3
+#endif
 
 // --- Thresholds ---
-#define COLLISION_DIST_CM    15
+#define COLLISION_DIST_CM    15    // hard floor on the filtered distance
+#define COLLISION_TTC_MS     600   // stop when impact is closer than this...
+#define COLLISION_MIN_CLOSING_MM_S 60  // ...and we're really closing (not noise)
+// (the ESP32 can change the first two at runtime, SET_THRESHOLD)
 #define IDLE_TIMEOUT_MS      10000
+#define INPUT_DEBOUNCE_MS    10    // bumpers / reset button: edges closer than this are bounce
+
+// --- Scheduler task periods ---
+#define SENSE_PERIOD_MS      20
+#define NAV_PERIOD_MS        20
+#define MOTOR_PERIOD_MS      20
+#define EVENT_PERIOD_MS      50
+#define TELEMETRY_PERIOD_MS  50    // 20 Hz
+// #define SCHED_REPORT        // task timing dump on the USB debug port every 5 s
+                               // (blocking prints; not where USB is the ESP32 link)
+
+// --- Collision recovery (non-blocking states in galileo_nav.ino) ---
+#define RECOVER_WAIT_MS      1000
+#define RECOVER_BACK_MS      1000
+#define RECOVER_SETTLE_MS    500
+#define RECOVER_TURN_MS      800
+
+// --- Wheels (motors.cpp, gains in wheel_control.h) ---
+// Quadrature encoders on both wheels, x4 decoded. Comment out to drive at a
+// fixed duty like before (no speed control, checkStuck() never fires).
+#define WHEEL_ENCODERS
+#define WHEEL_CRUISE_TPS     2000  // encoder ticks per second
+#define WHEEL_TURN_TPS       1200
+#define MOTOR_OPEN_LOOP_DUTY 200
+
+// --- Coverage planner (galileo_nav.ino) ---
+// Dead reckoning from the encoders feeds a 256-byte occupancy grid
+// (occupancy_grid.h); every new leg heads for floor not yet covered.
+// Comment out for straight-ahead wander with timed recovery turns.
+#define COVERAGE_PLANNER
+#define WHEEL_TICKS_PER_CM   80    // encoder ticks per cm of travel (push it 1 m, read wheelOdometry())
+#define WHEEL_BASE_MM        140   // between the wheels' contact patches
+#define SONAR_AHEAD_MM       100   // ultrasonic ahead of the wheel axle
+#define MAP_RANGE_MAX_MM     2000  // sonar readings trusted this far for the map
+#define WANDER_LEG_MS        6000  // re-plan after driving straight this long
+#define PLAN_AVOID_CM        40    // ...or when something is this close ahead
+#define TURN_TOLERANCE_DEG   10
+#define TURN_TIMEOUT_MS      4000  // give up on a planned turn (wheels slipping)
+#if defined(COVERAGE_PLANNER) && !defined(WHEEL_ENCODERS)
+    #undef COVERAGE_PLANNER        // no pose without encoders
+#endif
+
+// --- Ultrasonic ---
+// Ping interval per sensor; HC-SR04 wants >= 60 ms so late echoes from one
+// ping aren't read as the next
+#define ULTRASONIC_PERIOD_MS 60
+// Array (PIN_SONAR_* above, comment out a pair that isn't fitted): the
+// forward-facing sensors take turns within the period (sensors.cpp), the
+// rear one pings with the front one
+#define SONAR_SIDE_DEG       40    // front-left / front-right, off straight ahead
+#define SONAR_REAR_CLEAR_MM  350   // rear sensor: room to back up
+// #define RANGE_TRACE         // print "R,<ms>,<us>" per ping for host/filter_replay
 
 #endif // CONFIG_H
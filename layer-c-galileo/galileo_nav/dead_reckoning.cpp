@@ -0,0 +1,51 @@
+#include "dead_reckoning.h"
+
+// sin(x) ~ 16x(pi - x) / (5pi^2 - 4x(pi - x)) on 0..pi. With x in 1/512ths
+// of a half turn, p = a(512 - a) and the result in Q14 this is
+// (p << 14) / (5 * 16384 - p / 4), which stays inside 32 bits.
+int16_t sinQ14(Angle a) {
+    bool neg = a >= 32768;
+    int32_t h = (a & 32767) >> 6;
+    int32_t p = h * (512 - h);
+    int16_t s = (int16_t)((p << 14) / (5L * 16384 - p / 4));
+    return neg ? -s : s;
+}
+
+DeadReckoning::DeadReckoning(uint16_t ticksPerCm, uint16_t wheelBaseMm)
+    : ticksPerCm_(ticksPerCm),
+      turnTicks_((uint32_t)wheelBaseMm * ticksPerCm * 6283UL / 10000),   // 2 pi * base, in ticks
+      started_(false), lastLeft_(0), lastRight_(0), diffTicks_(0), heading_(0), xQ8_(0), yQ8_(0) {}
+
+void DeadReckoning::update(int32_t leftTicks, int32_t rightTicks) {
+    if (!started_) {
+        started_ = true;
+        lastLeft_ = leftTicks;
+        lastRight_ = rightTicks;
+        return;
+    }
+    int32_t dl = leftTicks - lastLeft_, dr = rightTicks - lastRight_;
+    lastLeft_ = leftTicks;
+    lastRight_ = rightTicks;
+
+    // Heading straight from the tick difference (kept mod one turn), so
+    // rounding never builds up
+    Angle before = heading_;
+    diffTicks_ = (diffTicks_ + dr - dl) % (int32_t)turnTicks_;
+    if (diffTicks_ < 0) diffTicks_ += turnTicks_;
+    heading_ = (Angle)((uint32_t)diffTicks_ * 65536UL / turnTicks_);
+
+    // Advance along the mean heading of this step; (dl + dr) is twice the
+    // centre's travel, >> 7 takes that and Q14 to Q8
+    Angle mid = before + angleDiff(heading_, before) / 2;
+    int32_t sum = dl + dr;
+    xQ8_ += (sum * cosQ14(mid)) >> 7;
+    yQ8_ += (sum * sinQ14(mid)) >> 7;
+}
+
+int32_t DeadReckoning::xMm() const {
+    return (xQ8_ >> 8) * 10 / ticksPerCm_;
+}
+
+int32_t DeadReckoning::yMm() const {
+    return (yQ8_ >> 8) * 10 / ticksPerCm_;
+}
@@ -0,0 +1,46 @@
+#ifndef DEAD_RECKONING_H
+#define DEAD_RECKONING_H
+
+#include <stdint.h>
+
+// Pose from the wheel encoders, integer only. Heading is a binary angle
+// (65536 = one turn, counter-clockwise positive, 0 = the way the rover
+// faced at boot), x/y in mm with +x straight ahead at boot.
+// No Arduino dependencies (host/nav_sim runs it through the sketch).
+
+typedef uint16_t Angle;
+
+#define ANGLE_DEG(d)  ((Angle)((int32_t)(d) * 65536L / 360))
+
+// Signed difference a - b, -32768..32767 (-180..180 degrees)
+inline int16_t angleDiff(Angle a, Angle b) { return (int16_t)(uint16_t)(a - b); }
+
+// sin/cos of a binary angle, 1.0 = 16384 (Bhaskara's approximation,
+// under 0.2% off; no table, no float)
+int16_t sinQ14(Angle a);
+inline int16_t cosQ14(Angle a) { return sinQ14(a + 16384); }
+
+class DeadReckoning {
+public:
+    // ticksPerCm: encoder ticks (x4) per cm of wheel travel
+    DeadReckoning(uint16_t ticksPerCm, uint16_t wheelBaseMm);
+
+    // Running encoder totals (wheelOdometry()); the first call only sets
+    // the reference
+    void update(int32_t leftTicks, int32_t rightTicks);
+
+    int32_t xMm() const;
+    int32_t yMm() const;
+    Angle heading() const { return heading_; }
+
+private:
+    uint16_t ticksPerCm_;
+    uint32_t turnTicks_;     // right - left ticks for one full turn on the spot
+    bool started_;
+    int32_t lastLeft_, lastRight_;
+    int32_t diffTicks_;      // right - left since boot, mod turnTicks_
+    Angle heading_;
+    int32_t xQ8_, yQ8_;      // ticks, 24.8 fixed point
+};
+
+#endif
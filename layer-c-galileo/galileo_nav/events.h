@@ -1,6 +1,8 @@
 #ifndef EVENTS_H
 #define EVENTS_H
 
+#include <stdint.h>
+
 // Event strings strictly matching the protocol
 #define EVENT_BOOT          "BOOT"
 #define EVENT_MOVE_START    "MOVE_START"
@@ -10,4 +12,54 @@
 #define EVENT_IDLE          "IDLE_TOO_LONG"
 #define EVENT_RESET         "RESET"
 
+// X(id, name): single source for the NavEvent enum and its name table.
+// Also compiled into the ESP32 firmware (esp32-server), which parses the
+// names coming off the UART with navEventFromName().
+#define NAV_EVENT_LIST(X) \
+    X(BOOT,        EVENT_BOOT) \
+    X(MOVE_START,  EVENT_MOVE_START) \
+    X(MOVE_STOP,   EVENT_MOVE_STOP) \
+    X(COLLISION,   EVENT_COLLISION) \
+    X(STUCK,       EVENT_STUCK) \
+    X(IDLE,        EVENT_IDLE) \
+    X(RESET,       EVENT_RESET)
+
+enum NavEvent : uint8_t {
+    NAV_NONE = 0,
+#define NAV_EVENT_ENUM(id, name) NAV_##id,
+    NAV_EVENT_LIST(NAV_EVENT_ENUM)
+#undef NAV_EVENT_ENUM
+    NAV_EVENT_COUNT
+};
+
+static constexpr const char* NAV_EVENT_NAMES[NAV_EVENT_COUNT] = {
+    "",
+#define NAV_EVENT_NAME(id, name) name,
+    NAV_EVENT_LIST(NAV_EVENT_NAME)
+#undef NAV_EVENT_NAME
+};
+
+// C++11-style constexpr (single return) so the AVR toolchain accepts it
+constexpr bool eventNameEquals(const char* a, const char* b) {
+    return *a == *b && (*a == '\0' || eventNameEquals(a + 1, b + 1));
+}
+
+constexpr NavEvent navEventFromNameAt(const char* s, uint8_t i) {
+    return i >= NAV_EVENT_COUNT ? NAV_NONE
+         : eventNameEquals(s, NAV_EVENT_NAMES[i]) ? (NavEvent)i
+         : navEventFromNameAt(s, i + 1);
+}
+
+// "COLLISION" -> NAV_COLLISION, anything unknown -> NAV_NONE
+constexpr NavEvent navEventFromName(const char* s) {
+    return (s && *s) ? navEventFromNameAt(s, 1) : NAV_NONE;
+}
+
+constexpr const char* navEventName(NavEvent e) {
+    return e < NAV_EVENT_COUNT ? NAV_EVENT_NAMES[e] : "";
+}
+
+static_assert(navEventFromName(EVENT_IDLE) == NAV_IDLE, "NavEvent name table out of sync");
+static_assert(eventNameEquals(navEventName(NAV_RESET), EVENT_RESET), "NavEvent name table out of sync");
+
 #endif // EVENTS_H
@@ -0,0 +1,236 @@
+#ifndef FAST_PIN_H
+#define FAST_PIN_H
+
+#include <Arduino.h>
+
+// Compile-time pin descriptors. The pin number is a template argument, so
+// port, bit mask and register are worked out by the compiler and a write is
+// one or two instructions instead of digitalWrite()'s table lookups. A pin
+// that can't do the job on this board fails to compile.
+//
+//   FastPin<P>::write(level), read()
+//   PinPair<A, B>::write(a, b)     both inputs of an H-bridge at once
+//   HBridge<Fwd, Bck>::drive(d)    d = -255..255, PWM on the active input
+//
+// C++11 only (the AVR core builds with -std=gnu++11): constexpr functions
+// are single return statements.
+//
+// Per board:
+//   UNO (ATmega328P)  PORTx writes, one store per bridge; PWM by switching
+//                     the timer compare output, no analogWrite()
+//   ESP32 / S3        GPIO W1TC then W1TS: the only in-between state is
+//                     both LOW (coast), never both HIGH (brake)
+//   Galileo, others   digitalWrite()/analogWrite() in the same safe order;
+//                     pins are still checked at compile time
+
+// =============================================================
+// UNO (ATmega328P)
+// =============================================================
+#if defined(__AVR_ATmega328P__)
+#define FAST_PIN_AVR
+
+// Arduino pin -> port: 0-7 PORTD, 8-13 PORTB, 14-19 (A0-A5) PORTC
+constexpr bool pinExists(uint8_t p) { return p < 20; }
+constexpr bool pinOutput(uint8_t p) { return pinExists(p) && p > 1; }   // 0/1 are the USB serial
+// Timer2's outputs (3, 11) are left out: Timer2 is the tick (tick_timer.h)
+constexpr bool pinPwm(uint8_t p) { return p == 5 || p == 6 || p == 9 || p == 10; }
+constexpr char pinPort(uint8_t p) { return p < 8 ? 'D' : p < 14 ? 'B' : 'C'; }
+constexpr uint8_t pinBit(uint8_t p) { return p < 8 ? p : p < 14 ? p - 8 : p - 14; }
+
+template<char Port> struct AvrPort;
+template<> struct AvrPort<'B'> {
+    static volatile uint8_t& out() { return PORTB; }
+    static volatile uint8_t& in() { return PINB; }
+};
+template<> struct AvrPort<'C'> {
+    static volatile uint8_t& out() { return PORTC; }
+    static volatile uint8_t& in() { return PINC; }
+};
+template<> struct AvrPort<'D'> {
+    static volatile uint8_t& out() { return PORTD; }
+    static volatile uint8_t& in() { return PIND; }
+};
+
+template<uint8_t Pin> struct FastPin {
+    static_assert(pinExists(Pin), "no such pin on the UNO");
+    static constexpr uint8_t mask() { return 1 << pinBit(Pin); }
+    typedef AvrPort<pinPort(Pin)> Port;
+
+    // Constant single-bit updates of PORTB/C/D compile to sbi/cbi (atomic)
+    static void write(bool high) {
+        static_assert(pinOutput(Pin), "pin 0/1 is the USB serial on the UNO");
+        if (high) Port::out() |= mask();
+        else Port::out() &= ~mask();
+    }
+    static bool read() { return Port::in() & mask(); }
+};
+
+template<uint8_t A, uint8_t B> struct PinPair {
+    static_assert(pinPort(A) == pinPort(B), "both bridge inputs must be on one port for a single-store update");
+    static_assert(A != B, "bridge inputs must be two different pins");
+
+    static void write(bool a, bool b) {
+        const uint8_t both = FastPin<A>::mask() | FastPin<B>::mask();
+        uint8_t set = (a ? FastPin<A>::mask() : 0) | (b ? FastPin<B>::mask() : 0);
+        uint8_t sreg = SREG;
+        cli();
+        volatile uint8_t& r = FastPin<A>::Port::out();
+        r = (r & ~both) | set;
+        SREG = sreg;
+    }
+};
+
+// Compare outputs of the pins analogWrite() would use (Timer0: 5, 6;
+// Timer1 in the core's 8-bit mode: 9, 10). disconnect() hands the pin back
+// to its PORT bit.
+template<uint8_t Pin> struct PwmPin;   // no specialisation = no PWM on that pin
+template<> struct PwmPin<5> {
+    static void connect(uint8_t d) { OCR0B = d; TCCR0A |= _BV(COM0B1); }
+    static void disconnect() { TCCR0A &= ~_BV(COM0B1); }
+};
+template<> struct PwmPin<6> {
+    static void connect(uint8_t d) { OCR0A = d; TCCR0A |= _BV(COM0A1); }
+    static void disconnect() { TCCR0A &= ~_BV(COM0A1); }
+};
+template<> struct PwmPin<9> {
+    static void connect(uint8_t d) { OCR1A = d; TCCR1A |= _BV(COM1A1); }
+    static void disconnect() { TCCR1A &= ~_BV(COM1A1); }
+};
+template<> struct PwmPin<10> {
+    static void connect(uint8_t d) { OCR1B = d; TCCR1A |= _BV(COM1B1); }
+    static void disconnect() { TCCR1A &= ~_BV(COM1B1); }
+};
+
+template<uint8_t Fwd, uint8_t Bck> struct HBridge {
+    static_assert(pinPwm(Fwd) && pinPwm(Bck), "H-bridge inputs need Timer0/Timer1 PWM pins (5, 6, 9, 10)");
+
+    // Both outputs drop to their PORT bits, one store sets both levels (full
+    // duty or off), then the active input gets its PWM back. Interrupts
+    // are off throughout, so no ISR sees a half-switched bridge.
+    static void drive(int16_t duty) {
+        uint8_t sreg = SREG;
+        cli();
+        PwmPin<Fwd>::disconnect();
+        PwmPin<Bck>::disconnect();
+        PinPair<Fwd, Bck>::write(duty >= 255, duty <= -255);
+        if (duty > 0 && duty < 255) PwmPin<Fwd>::connect(duty);
+        else if (duty < 0 && duty > -255) PwmPin<Bck>::connect(-duty);
+        SREG = sreg;
+    }
+};
+
+// =============================================================
+// ESP32 / ESP32-S3
+// =============================================================
+#elif defined(ESP32)
+#define FAST_PIN_ESP32
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+constexpr bool pinExists(uint8_t p) { return p <= 48 && !(p >= 22 && p <= 25); }
+// 26-32 are the SPI flash / PSRAM on every S3 module
+constexpr bool pinOutput(uint8_t p) { return pinExists(p) && !(p >= 26 && p <= 32); }
+#else
+constexpr bool pinExists(uint8_t p) { return p <= 39 && p != 20 && p != 24 && !(p >= 28 && p <= 31); }
+// 6-11 are the SPI flash, 34-39 are input only
+constexpr bool pinOutput(uint8_t p) { return pinExists(p) && p < 34 && !(p >= 6 && p <= 11); }
+#endif
+constexpr bool pinPwm(uint8_t p) { return pinOutput(p); }   // LEDC reaches any output via the GPIO matrix
+
+template<uint8_t Pin> struct FastPin {
+    static_assert(pinExists(Pin), "no such GPIO on this ESP32");
+    static constexpr uint32_t mask() { return 1UL << (Pin & 31); }
+
+    static void write(bool high) {
+        static_assert(pinOutput(Pin), "GPIO can't drive an output on this ESP32 (flash/PSRAM or input only)");
+        if (Pin < 32) REG_WRITE(high ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, mask());
+        else REG_WRITE(high ? GPIO_OUT1_W1TS_REG : GPIO_OUT1_W1TC_REG, mask());
+    }
+    static bool read() { return (Pin < 32 ? REG_READ(GPIO_IN_REG) : REG_READ(GPIO_IN1_REG)) & mask(); }
+};
+
+template<uint8_t A, uint8_t B> struct PinPair {
+    static_assert((A < 32) == (B < 32), "both bridge inputs must be in one GPIO bank (0-31 or 32+)");
+    static_assert(A != B, "bridge inputs must be two different pins");
+    static_assert(pinOutput(A) && pinOutput(B), "GPIO can't drive an output on this ESP32 (flash/PSRAM or input only)");
+
+    // The GPIO block has no single set+clear register: clear first, so the
+    // bridge can pass through coast but never brake. Both are plain stores,
+    // safe against the other core (no read-modify-write).
+    static void write(bool a, bool b) {
+        uint32_t clear = (a ? 0 : FastPin<A>::mask()) | (b ? 0 : FastPin<B>::mask());
+        uint32_t set = (a ? FastPin<A>::mask() : 0) | (b ? FastPin<B>::mask() : 0);
+        if (A < 32) {
+            if (clear) REG_WRITE(GPIO_OUT_W1TC_REG, clear);
+            if (set) REG_WRITE(GPIO_OUT_W1TS_REG, set);
+        } else {
+            if (clear) REG_WRITE(GPIO_OUT1_W1TC_REG, clear);
+            if (set) REG_WRITE(GPIO_OUT1_W1TS_REG, set);
+        }
+    }
+};
+
+// =============================================================
+// GALILEO / OTHER BOARDS
+// =============================================================
+#else
+#define FAST_PIN_PORTABLE
+
+#if defined(__ARDUINO_X86__)
+// Galileo: Arduino header pins 0-13 plus A0-A5; PWM on the UNO-style pins
+constexpr bool pinExists(uint8_t p) { return p < 20; }
+constexpr bool pinPwm(uint8_t p) { return p == 3 || p == 5 || p == 6 || p == 9 || p == 10 || p == 11; }
+#else
+constexpr bool pinExists(uint8_t p) { return p < NUM_DIGITAL_PINS; }
+constexpr bool pinPwm(uint8_t p) { return pinExists(p); }   // can't tell portably; analogWrite() decides
+#endif
+constexpr bool pinOutput(uint8_t p) { return pinExists(p); }
+
+template<uint8_t Pin> struct FastPin {
+    static_assert(pinExists(Pin), "no such pin on this board");
+    static void write(bool high) { digitalWrite(Pin, high ? HIGH : LOW); }
+    static bool read() { return digitalRead(Pin) == HIGH; }
+};
+
+template<uint8_t A, uint8_t B> struct PinPair {
+    static_assert(A != B, "bridge inputs must be two different pins");
+    // Whatever goes LOW goes first: coast, never brake, in between
+    static void write(bool a, bool b) {
+        if (!a) FastPin<A>::write(false);
+        if (!b) FastPin<B>::write(false);
+        if (a) FastPin<A>::write(true);
+        if (b) FastPin<B>::write(true);
+    }
+};
+#endif
+
+// PWM through the core (LEDC on the ESP32, the Galileo's PWM expander),
+// releasing the inactive input before driving the other one
+#ifndef FAST_PIN_AVR
+template<uint8_t Fwd, uint8_t Bck> struct HBridge {
+    static_assert(pinPwm(Fwd) && pinPwm(Bck), "H-bridge inputs need PWM capable pins");
+
+    static void drive(int16_t duty) {
+        if (duty > 0) {
+            digitalWrite(Bck, LOW);
+            analogWrite(Fwd, duty > 255 ? 255 : duty);
+        } else if (duty < 0) {
+            digitalWrite(Fwd, LOW);
+            analogWrite(Bck, duty < -255 ? 255 : -duty);
+        } else {
+            digitalWrite(Fwd, LOW);
+            digitalWrite(Bck, LOW);
+        }
+    }
+};
+#endif
+
+// True if no pin appears twice in p[0..n) (for a board's pin map)
+constexpr bool pinsDistinct(const uint8_t* p, uint8_t n, uint8_t i = 0, uint8_t j = 1) {
+    return i >= n ? true
+         : j >= n ? pinsDistinct(p, n, i + 1, i + 2)
+         : p[i] != p[j] && pinsDistinct(p, n, i, j + 1);
+}
+
+#endif
@@ -4,91 +4,450 @@
 #include "serial_events.h"
 #include "motors.h"
 #include "sensors.h"
+#include "scheduler.h"
+#include "fast_pin.h"
+#include "dead_reckoning.h"
+#include "occupancy_grid.h"
+
+// Everything runs as scheduler tasks (see config.h for periods):
+//   sense   - bumpers, filtered ultrasonic, stuck (encoder stall), reset button
+//   nav     - wander / recovery state machine, decides the motion; with
+//             COVERAGE_PLANNER also dead reckoning and the coverage map
+//   motor   - sets wheel speeds for the motion, PI speed control per wheel
+//   events  - BOOT announce, event delivery/retries
+//   telemetry - 20 Hz state frame for the ESP32 (distance, bumpers, motion)
+// Recovery is a sequence of timed states, so sensing never pauses.
+// ESP32 commands (STOP, SET_SPEED, ...) are applied by the scheduler's tick
+// hook, before any task of that tick runs.
+
+// BOOT is held back (without blocking) until the ESP32's UART is listening;
+// its firmware brings UART2 up within ~300 ms of power-on.
+#define BOOT_ANNOUNCE_MS   500
+#define SCHED_REPORT_MS    5000   // SCHED_REPORT (config.h)
+
+#if defined(SCHED_REPORT) && defined(LINK_ON_DEBUG_SERIAL)
+#error "SCHED_REPORT prints on the port that carries the ESP32 link"
+#endif
+
+// Every pin in config.h used once, and outputs on pins that can drive one
+// (per-board rules in fast_pin.h; the motor pins are checked by HBridge)
+static constexpr uint8_t PIN_MAP[] = {
+    PIN_MOTOR_LEFT_FWD, PIN_MOTOR_LEFT_BCK, PIN_MOTOR_RIGHT_FWD, PIN_MOTOR_RIGHT_BCK,
+    PIN_ULTRASONIC_TRIG, PIN_ULTRASONIC_ECHO, PIN_BUMP_LEFT, PIN_BUMP_RIGHT, PIN_RESET_BUTTON,
+#ifdef USE_SOFTWARE_SERIAL
+    PIN_RX_FROM_ESP, PIN_TX_TO_ESP,
+#endif
+#ifdef WHEEL_ENCODERS
+    PIN_ENC_LEFT_A, PIN_ENC_LEFT_B, PIN_ENC_RIGHT_A, PIN_ENC_RIGHT_B,
+#endif
+#ifdef PIN_SONAR_LEFT_TRIG
+    PIN_SONAR_LEFT_TRIG, PIN_SONAR_LEFT_ECHO,
+#endif
+#ifdef PIN_SONAR_RIGHT_TRIG
+    PIN_SONAR_RIGHT_TRIG, PIN_SONAR_RIGHT_ECHO,
+#endif
+#ifdef PIN_SONAR_REAR_TRIG
+    PIN_SONAR_REAR_TRIG, PIN_SONAR_REAR_ECHO,
+#endif
+};
+static_assert(pinsDistinct(PIN_MAP, sizeof(PIN_MAP)), "config.h uses a pin twice");
+static_assert(pinOutput(PIN_ULTRASONIC_TRIG), "PIN_ULTRASONIC_TRIG can't be an output on this board");
+#ifdef PIN_SONAR_LEFT_TRIG
+static_assert(pinOutput(PIN_SONAR_LEFT_TRIG), "PIN_SONAR_LEFT_TRIG can't be an output on this board");
+#endif
+#ifdef PIN_SONAR_RIGHT_TRIG
+static_assert(pinOutput(PIN_SONAR_RIGHT_TRIG), "PIN_SONAR_RIGHT_TRIG can't be an output on this board");
+#endif
+#ifdef PIN_SONAR_REAR_TRIG
+static_assert(pinOutput(PIN_SONAR_REAR_TRIG), "PIN_SONAR_REAR_TRIG can't be an output on this board");
+#endif
+#ifdef USE_SOFTWARE_SERIAL
+static_assert(pinOutput(PIN_TX_TO_ESP), "PIN_TX_TO_ESP can't be an output on this board");
+#endif
+
+// =============================================================
+// SHARED STATE (written by one task, read by the others)
+// =============================================================
+
+struct SenseState {
+    bool collision;
+    bool stuck;
+    bool reset;
+    uint8_t bumpers;      // TLM_BUMP_* bits, pressed or tapped since the last sense
+};
+
+enum Motion {
+    MOTION_STOP = 0,
+    MOTION_FORWARD,
+    MOTION_BACKWARD,
+    MOTION_LEFT,
+    MOTION_RIGHT
+};
+static_assert(MOTION_RIGHT < TELEMETRY_MOTION_COUNT, "Motion is sent as an index into TELEMETRY_MOTION_NAMES");
+
+enum DriveState {
+    ST_STOPPED = 0,       // parked, wander restarts after a pause
+    ST_WANDER,            // driving forward
+    ST_RECOVER_WAIT,      // collision: stopped, let the rover settle
+    ST_RECOVER_BACK,      // reversing away
+    ST_RECOVER_SETTLE,    // stopped between back-up and turn
+    ST_RECOVER_TURN,      // pivoting; repeats while the way ahead is blocked
+    ST_RESET_HELD,        // reset button down, wait for release
+    ST_TURN_TO            // pivoting to the planned heading before a leg
+};
+
+SenseState sensed = { false, false, false, 0 };
+Motion motion = MOTION_STOP;
+Motion appliedMotion = MOTION_STOP;
+DriveState driveState = ST_STOPPED;
+unsigned long stateSince = 0;
 
 unsigned long lastActivityTime = 0;
+unsigned long lastSchedReport = 0;
 bool isStuckReported = false;
+bool bootAnnounced = false;
+bool wanderPaused = false;    // PAUSE_WANDER from the ESP32
 
-void setup() {
-    Serial.begin(115200); // Debug serial
-    setupSerialEvents();
-    setupMotors();
-    setupSensors();
-    
-    // Give ESP32 time to boot
-    delay(2000);
-    sendEvent(EVENT_BOOT);
-    lastActivityTime = millis();
+void enterState(DriveState s, Motion m, unsigned long now) {
+    driveState = s;
+    motion = m;
+    stateSince = now;
 }
 
-void loop() {
-    unsigned long now = millis();
-    
-    // 1. Check Manual Reset
-    if (checkReset()) {
-        stopMotors();
-        sendEvent(EVENT_RESET);
-        // Wait for release
-        while(checkReset()) delay(100);
-        lastActivityTime = now;
-        return; 
+// =============================================================
+// COVERAGE MAP / PLANNER
+// =============================================================
+// Pose from the encoders, a scrolling occupancy grid around it, and a
+// planner that points each new leg at floor not covered yet. Without it
+// the rover drives straight on and recovery turns a random side for
+// RECOVER_TURN_MS.
+
+#ifdef COVERAGE_PLANNER
+DeadReckoning odo(WHEEL_TICKS_PER_CM, WHEEL_BASE_MM);
+OccupancyGrid grid;
+Angle targetHeading = 0;
+
+int32_t towardX(Angle a, int32_t mm) { return odo.xMm() + ((mm * cosQ14(a)) >> 14); }
+int32_t towardY(Angle a, int32_t mm) { return odo.yMm() + ((mm * sinQ14(a)) >> 14); }
+int32_t aheadX(int32_t mm) { return towardX(odo.heading(), mm); }
+int32_t aheadY(int32_t mm) { return towardY(odo.heading(), mm); }
+
+void updateMap() {
+    int32_t left, right;
+    wheelOdometry(left, right);
+    odo.update(left, right);
+    grid.visit(odo.xMm(), odo.yMm());
+    // Not mid-pivot: the filtered distances lag the heading by a few pings
+    if (appliedMotion == MOTION_LEFT || appliedMotion == MOTION_RIGHT) return;
+    // Every sensor sits SONAR_AHEAD_MM out from the axle along its bearing
+    for (uint8_t i = 0; i < sonarCount(); i++) {
+        uint16_t mm;
+        uint32_t ms;
+        if (!sonarReading(i, mm, ms)) continue;
+        Angle a = odo.heading() + ANGLE_DEG(sonarAngleDeg(i));
+        if (mm > MAP_RANGE_MAX_MM) mm = MAP_RANGE_MAX_MM;
+        grid.observe(towardX(a, SONAR_AHEAD_MM), towardY(a, SONAR_AHEAD_MM), a, mm, MAP_RANGE_MAX_MM);
     }
+}
 
-    // 2. Navigation Logic
-    bool moving = isMoving();
-
-    if (moving) {
-        // We are moving, check for bad things
-        if (checkCollision()) {
-            stopMotors();
-            sendEvent(EVENT_COLLISION);
-            
-            // Recovery Maneuver
-            delay(1000); // Wait a bit
-            moveBackward();
-            delay(1000);
-            stopMotors();
-            delay(500);
-            turnLeft(); // Or random?
-            delay(800);
-            stopMotors();
-            
-            lastActivityTime = millis();
-        }
-        else if (checkStuck()) {
-             if (!isStuckReported) {
-                 stopMotors(); // Maybe? Or keep trying? Use STOP for safety.
-                 sendEvent(EVENT_STUCK);
-                 isStuckReported = true;
-                 lastActivityTime = now;
-             }
+// Whatever stopped us is just past the front of the rover
+void markAhead() {
+    grid.markBlocked(aheadX(SONAR_AHEAD_MM + GRID_CELL_MM / 2), aheadY(SONAR_AHEAD_MM + GRID_CELL_MM / 2));
+}
+
+// With no rear sensor, only reverse over floor we've already driven.
+// Bumping again near where we last skipped it means turning on the spot
+// isn't getting us out, so that time back up regardless.
+bool skippedBack = false;
+int32_t skippedX, skippedY;
+
+bool mapRoomBehind() {
+    int32_t x = odo.xMm(), y = odo.yMm();
+    if (skippedBack && labs(x - skippedX) < 2 * GRID_CELL_MM && labs(y - skippedY) < 2 * GRID_CELL_MM) {
+        skippedBack = false;
+        return true;
+    }
+    skippedBack = false;
+    for (int32_t mm = GRID_CELL_MM; mm <= 2 * GRID_CELL_MM; mm += GRID_CELL_MM) {
+        if (grid.at(aheadX(-mm), aheadY(-mm)) != CELL_VISITED) {
+            skippedBack = true;
+            skippedX = x;
+            skippedY = y;
+            return false;
         }
-        else {
-            isStuckReported = false; // Reset flag if moving fine
+    }
+    return true;
+}
+#else
+void updateMap() {}
+void markAhead() {}
+bool mapRoomBehind() { return true; }
+#endif
+
+// Room to back up out of a collision: the rear sensor if there is one
+bool roomBehind() {
+    for (uint8_t i = 0; i < sonarCount(); i++) {
+        int16_t a = sonarAngleDeg(i);
+        uint16_t mm;
+        uint32_t ms;
+        if ((a > 90 || a < -90) && sonarReading(i, mm, ms)) return mm >= SONAR_REAR_CLEAR_MM;
+    }
+    return mapRoomBehind();
+}
+
+// Pivot towards the planner's pick (or, without it, a random side; a turn
+// that's repeated keeps its side)
+void startTurn(DriveState s, unsigned long now) {
+#ifdef COVERAGE_PLANNER
+    targetHeading = grid.pickHeading(odo.xMm(), odo.yMm(), odo.heading(), random(PLAN_DIRECTIONS));
+    enterState(s, angleDiff(targetHeading, odo.heading()) > 0 ? MOTION_LEFT : MOTION_RIGHT, now);
+#else
+    bool turning = motion == MOTION_LEFT || motion == MOTION_RIGHT;
+    enterState(s, turning ? motion : random(2) ? MOTION_LEFT : MOTION_RIGHT, now);
+#endif
+}
+
+// Pointing the planned way (or just past it), or out of time
+bool turnDone(unsigned long inState) {
+#ifdef COVERAGE_PLANNER
+    int16_t err = angleDiff(targetHeading, odo.heading());
+    bool there = motion == MOTION_LEFT ? err <= ANGLE_DEG(TURN_TOLERANCE_DEG) : err >= -ANGLE_DEG(TURN_TOLERANCE_DEG);
+    return there || inState >= TURN_TIMEOUT_MS;
+#else
+    return inState >= RECOVER_TURN_MS;
+#endif
+}
+
+// A new leg: face the planned heading first if it's off to one side
+void startLeg(unsigned long now) {
+#ifdef COVERAGE_PLANNER
+    startTurn(ST_TURN_TO, now);
+    if (!turnDone(0)) return;
+#endif
+    enterState(ST_WANDER, MOTION_FORWARD, now);
+}
+
+// =============================================================
+// ESP32 COMMANDS
+// =============================================================
+
+void applyCommand(const LinkCommand& c, unsigned long now) {
+    switch (c.id) {
+        case CMD_STOP:
+            // A running recovery is cut short too; the reset button still wins
+            if (driveState != ST_RESET_HELD) {
+                lastActivityTime = now;
+                enterState(ST_STOPPED, MOTION_STOP, now);
+            }
+            break;
+        case CMD_SET_SPEED:
+            setSpeedPercent(c.value ? c.value : 100);
+            break;
+        case CMD_PAUSE_WANDER:
+            wanderPaused = c.value != 0;
+            if (wanderPaused && (driveState == ST_WANDER || driveState == ST_TURN_TO)) enterState(ST_STOPPED, MOTION_STOP, now);
+            lastActivityTime = now;
+            break;
+        case CMD_SET_THRESHOLD:
+            if (c.arg == THRESH_COLLISION_CM) setCollisionDistanceCm(c.value);
+            else if (c.arg == THRESH_TTC_MS) setCollisionTtcMs(c.value);
+            break;
+    }
+}
+
+// Scheduler tick hook: everything that arrived since the last tick, so sense
+// and nav always run against the latest commanded state
+void commandHook(unsigned long now) {
+    LinkCommand c;
+    while (nextCommand(c)) applyCommand(c, now);
+}
+
+// =============================================================
+// TASKS
+// =============================================================
+
+// Every task gets the tick time (TaskFn, scheduler.h); sense and telemetry
+// have no use for it
+void senseTask(unsigned long /*now*/) {
+    sensed.collision = checkCollision();
+    sensed.stuck = checkStuck();
+    sensed.reset = checkReset();
+    sensed.bumpers = bumperBits(BUMPERS_NAV);
+}
+
+// While driving under our own steam (a leg or the pivot into one): a
+// collision starts the recovery, a stall stops us. True if either did.
+bool hazard(bool collided, unsigned long now) {
+    if (collided) {
+        sendEvent(NAV_COLLISION);
+        markAhead();
+        enterState(ST_RECOVER_WAIT, MOTION_STOP, now);
+        return true;
+    }
+    if (sensed.stuck) {
+        if (!isStuckReported) {
+            sendEvent(NAV_STUCK);
+            isStuckReported = true;
+            lastActivityTime = now;
+            enterState(ST_STOPPED, MOTION_STOP, now); // Use STOP for safety.
+            return true;
         }
-    } 
-    else {
-        // We are stopped/idle
-        
-        // Simple Autonomous Behavior:
-        // If we've been idle for a bit, start moving again?
-        // Or wait for a command? 
-        // The prompt says "Move the rover around the room". 
-        // Let's implement a simple "Wander" behavior: 
-        // If not moving, wait 2 seconds, then start moving again.
-        
-        if (now - lastActivityTime > 2000 && now - lastActivityTime < IDLE_TIMEOUT_MS) {
-             // Basic randomized turn could be added here before moving
-             sendEvent(EVENT_MOVE_START);
-             moveForward();
-             // In a real robot, we might turn slightly if we just hit something
+        return false;
+    }
+    isStuckReported = false; // Reset flag if moving fine
+    return false;
+}
+
+void navTask(unsigned long now) {
+    unsigned long inState = now - stateSince;
+    updateMap();
+
+    // 1. Manual reset wins over everything
+    if (sensed.reset && driveState != ST_RESET_HELD) {
+        sendEvent(NAV_RESET);
+        enterState(ST_RESET_HELD, MOTION_STOP, now);
+        return;
+    }
+
+    switch (driveState) {
+        case ST_RESET_HELD:
+            if (!sensed.reset) {
+                lastActivityTime = now;
+                enterState(ST_STOPPED, MOTION_STOP, now);
+            }
+            break;
+
+        case ST_WANDER:
+            if (!hazard(sensed.collision, now)) {
+#ifdef COVERAGE_PLANNER
+                // Re-plan after a long leg, or turn off early rather than
+                // drive up to the obstacle and recover
+                long cm = lastDistanceCm();
+                if (inState >= WANDER_LEG_MS || (cm >= 0 && cm < PLAN_AVOID_CM)) startLeg(now);
+#endif
+            }
+            break;
+
+        case ST_TURN_TO:
+            // A bump or stall mid-pivot is handled like one on a leg. Not
+            // the sonars: we're turning away from what they see ahead.
+            if (!hazard(sensed.bumpers != 0, now) && turnDone(inState)) enterState(ST_WANDER, MOTION_FORWARD, now);
+            break;
+
+        // Recovery Maneuver: wait, back up, settle, turn
+        case ST_RECOVER_WAIT:
+            if (inState >= RECOVER_WAIT_MS) {
+                if (roomBehind()) enterState(ST_RECOVER_BACK, MOTION_BACKWARD, now);
+                else startTurn(ST_RECOVER_TURN, now);
+            }
+            break;
+        case ST_RECOVER_BACK:
+            if (inState >= RECOVER_BACK_MS) enterState(ST_RECOVER_SETTLE, MOTION_STOP, now);
+            break;
+        case ST_RECOVER_SETTLE:
+            if (inState >= RECOVER_SETTLE_MS) startTurn(ST_RECOVER_TURN, now);
+            break;
+        case ST_RECOVER_TURN:
+            if (turnDone(inState)) {
+                if (sensed.collision) {
+                    markAhead();  // still facing something
+                    startTurn(ST_RECOVER_TURN, now);
+                } else {
+                    lastActivityTime = now;
+                    enterState(ST_STOPPED, MOTION_STOP, now);
+                }
+            }
+            break;
+
+        case ST_STOPPED:
+        default:
+            // Wander: if not moving, wait 2 seconds, then start a new leg
+            if (!wanderPaused && now - lastActivityTime > 2000 && now - lastActivityTime < IDLE_TIMEOUT_MS) {
+                sendEvent(NAV_MOVE_START);
+                startLeg(now);
+            }
+            // Check for Idle Timeout
+            if (now - lastActivityTime > IDLE_TIMEOUT_MS) {
+                sendEvent(NAV_IDLE);
+                lastActivityTime = now; // Reset timer so we don't spam
+            }
+            break;
+    }
+}
+
+void motorTask(unsigned long now) {
+    if (motion != appliedMotion) {
+        switch (motion) {
+            case MOTION_FORWARD:  moveForward(); break;
+            case MOTION_BACKWARD: moveBackward(); break;
+            case MOTION_LEFT:     turnLeft(); break;
+            case MOTION_RIGHT:    turnRight(); break;
+            default:              stopMotors(); break;
         }
-        
-        // Check for Idle Timeout
-        if (now - lastActivityTime > IDLE_TIMEOUT_MS) {
-            sendEvent(EVENT_IDLE);
-            lastActivityTime = now; // Reset timer so we don't spam
+        appliedMotion = motion;
+    }
+    updateMotors(now); // wheel speed PI, fixed rate
+}
+
+void telemetryTask(unsigned long /*now*/) {
+    LinkTelemetry t;
+    long cm = lastDistanceCm();
+    t.distanceCm = cm < 0 ? TELEMETRY_NO_DISTANCE : (uint16_t)cm;
+    t.bumpers = bumperBits(BUMPERS_TELEMETRY);  // own latch: taps since the last frame
+    t.resetHeld = sensed.reset;
+    t.motion = appliedMotion;
+    t.driveState = driveState;
+    t.overruns = totalOverruns() & 0xFF;
+    sendTelemetry(t);
+}
+
+void eventTask(unsigned long now) {
+    if (!bootAnnounced && now >= BOOT_ANNOUNCE_MS) {
+        sendEvent(NAV_BOOT);
+        bootAnnounced = true;
+    }
+
+    serviceSerialEvents(now); // ACKs in, queued events out (with retries)
+
+#ifdef SCHED_REPORT
+    if (now - lastSchedReport > SCHED_REPORT_MS) {
+        lastSchedReport = now;
+        for (uint8_t i = 0; i < taskCount(); i++) {
+            const TaskStats& t = taskStats(i);
+            Serial.print("SCHED ");
+            Serial.print(t.name);
+            Serial.print(" last=");
+            Serial.print(t.lastUs);
+            Serial.print("us max=");
+            Serial.print(t.maxUs);
+            Serial.print("us overruns=");
+            Serial.println(t.overruns);
         }
     }
-    
-    delay(50); // Small loop delay
+#endif
+}
+
+// =============================================================
+// SETUP / LOOP
+// =============================================================
+
+void setup() {
+    Serial.begin(115200); // Debug serial
+    setupSerialEvents();
+    setupMotors();
+    setupSensors();
+    lastActivityTime = millis();
+
+    addTask("sense", senseTask, SENSE_PERIOD_MS);
+    addTask("nav", navTask, NAV_PERIOD_MS);
+    addTask("motor", motorTask, MOTOR_PERIOD_MS);
+    addTask("events", eventTask, EVENT_PERIOD_MS);
+    addTask("telemetry", telemetryTask, TELEMETRY_PERIOD_MS);
+    setTickHook(commandHook);
+}
+
+void loop() {
+    runScheduler(); // No delay(): every task keeps its own period
+    pumpSerialRx(); // ACKs and ESP32 commands off the UART
+    pumpSerialTx(); // Hands queued frames to the UART as it has room
 }
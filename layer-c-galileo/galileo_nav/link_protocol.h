@@ -0,0 +1,255 @@
+#ifndef LINK_PROTOCOL_H
+#define LINK_PROTOCOL_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Binary framing for the Galileo <-> ESP32 UART (9600 baud). Header only,
+// no Arduino dependencies; the ESP32 firmware includes this file too.
+//
+//   0xA5  TYPE  SEQ  LEN  PAYLOAD[LEN]  CRC8
+//
+// CRC-8 (poly 0x07) covers TYPE..PAYLOAD. EVENT (Galileo -> ESP32) and
+// COMMAND (ESP32 -> Galileo) frames are acknowledged with an ACK frame
+// carrying the same SEQ; the sender retransmits until it gets one. Each
+// direction has its own SEQ counter. Other frame types are fire-and-forget.
+
+#define LINK_SYNC         0xA5
+#define LINK_HEADER_LEN   4
+#define LINK_MAX_PAYLOAD  16
+#define LINK_FRAME_MAX    (LINK_HEADER_LEN + LINK_MAX_PAYLOAD + 1)
+
+#define LINK_ACK_TIMEOUT_MS  120   // ~6 byte times each way plus the ESP32's loop
+#define LINK_MAX_RETRIES     5
+#define LINK_DUP_WINDOW_MS   2000  // receiver treats a repeated SEQ within this as a retry
+
+enum LinkFrameType : uint8_t {
+    LINK_EVENT     = 0x01,  // payload: NavEvent id (1 byte), ACKed
+    LINK_ACK       = 0x02,  // no payload, SEQ = the frame being acknowledged
+    LINK_TELEMETRY = 0x03,  // payload: see LinkTelemetry, 20 Hz, SEQ = own counter
+    LINK_COMMAND   = 0x04   // payload: see LinkCommand, ACKed, ESP32 -> Galileo
+};
+
+struct LinkFrame {
+    uint8_t type;
+    uint8_t seq;
+    uint8_t len;
+    uint8_t payload[LINK_MAX_PAYLOAD];
+};
+
+inline uint8_t linkCrc8(const uint8_t* p, uint8_t n) {
+    uint8_t crc = 0;
+    while (n--) {
+        crc ^= *p++;
+        for (uint8_t k = 0; k < 8; k++) crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+// Writes a complete frame into out (LINK_FRAME_MAX bytes), returns its length
+inline uint8_t linkEncode(uint8_t* out, uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t len) {
+    if (len > LINK_MAX_PAYLOAD) len = LINK_MAX_PAYLOAD;
+    out[0] = LINK_SYNC;
+    out[1] = type;
+    out[2] = seq;
+    out[3] = len;
+    if (len) memcpy(out + LINK_HEADER_LEN, payload, len);
+    out[LINK_HEADER_LEN + len] = linkCrc8(out + 1, LINK_HEADER_LEN - 1 + len);
+    return LINK_HEADER_LEN + len + 1;
+}
+
+// =============================================================
+// TELEMETRY
+// =============================================================
+// Payload, 4 or 5 bytes (9-10 on the wire, ~200 B/s at 20 Hz of 960):
+//   [0] flags: b0 bumper L, b1 bumper R, b2 reset button, b3 ABS,
+//              b4-6 motion (TELEMETRY_MOTION_NAMES order)
+//   [1] nav drive state (galileo_nav.ino DriveState)
+//   [2] scheduler overruns since boot, mod 256
+//   ABS: [3..4] distance cm, u16 LE (0xFFFF = no reading)
+//   else [3] distance change since the previous frame, int8 cm
+// Frames aren't ACKed, so every TELEMETRY_KEYFRAME_EVERY-th frame (and any
+// change too big for a delta) is absolute; a receiver that sees a SEQ gap
+// ignores deltas until the next one.
+
+#define TELEMETRY_KEYFRAME_EVERY  10
+#define TELEMETRY_NO_DISTANCE     0xFFFF
+
+#define TLM_BUMP_LEFT   0x01
+#define TLM_BUMP_RIGHT  0x02
+#define TLM_RESET       0x04
+#define TLM_ABS         0x08
+#define TLM_MOTION_SHIFT 4
+
+#define TELEMETRY_MOTION_COUNT 5
+static constexpr const char* TELEMETRY_MOTION_NAMES[TELEMETRY_MOTION_COUNT] = { "stop", "forward", "backward", "left", "right" };
+
+struct LinkTelemetry {
+    uint16_t distanceCm;    // TELEMETRY_NO_DISTANCE if unknown
+    uint8_t bumpers;        // TLM_BUMP_LEFT | TLM_BUMP_RIGHT
+    bool resetHeld;
+    uint8_t motion;
+    uint8_t driveState;
+    uint8_t overruns;
+};
+
+// Returns the payload length. prevCm is the distance the receiver last
+// reconstructed (what the previous frame carried).
+inline uint8_t linkEncodeTelemetry(uint8_t* out, const LinkTelemetry& t, bool keyframe, uint16_t prevCm) {
+    int32_t delta = (int32_t)t.distanceCm - prevCm;
+    bool abs = keyframe || t.distanceCm == TELEMETRY_NO_DISTANCE || prevCm == TELEMETRY_NO_DISTANCE ||
+               delta < -128 || delta > 127;
+    out[0] = (t.bumpers & (TLM_BUMP_LEFT | TLM_BUMP_RIGHT)) | (t.resetHeld ? TLM_RESET : 0) |
+             (abs ? TLM_ABS : 0) | ((t.motion & 0x07) << TLM_MOTION_SHIFT);
+    out[1] = t.driveState;
+    out[2] = t.overruns;
+    if (abs) {
+        out[3] = t.distanceCm & 0xFF;
+        out[4] = t.distanceCm >> 8;
+        return 5;
+    }
+    out[3] = (uint8_t)(int8_t)delta;
+    return 4;
+}
+
+// Decodes into t, using t.distanceCm as the delta base. Returns false for
+// a malformed payload or a delta frame without a valid base (haveBase).
+inline bool linkDecodeTelemetry(const uint8_t* p, uint8_t len, LinkTelemetry& t, bool haveBase) {
+    if (len < 4) return false;
+    bool abs = p[0] & TLM_ABS;
+    if (abs && len < 5) return false;
+    t.bumpers = p[0] & (TLM_BUMP_LEFT | TLM_BUMP_RIGHT);
+    t.resetHeld = p[0] & TLM_RESET;
+    t.motion = (p[0] >> TLM_MOTION_SHIFT) & 0x07;
+    t.driveState = p[1];
+    t.overruns = p[2];
+    if (abs) {
+        t.distanceCm = p[3] | (p[4] << 8);
+        return true;
+    }
+    if (!haveBase || t.distanceCm == TELEMETRY_NO_DISTANCE) return false;
+    t.distanceCm = (uint16_t)(t.distanceCm + (int8_t)p[3]);
+    return true;
+}
+
+// =============================================================
+// COMMANDS
+// =============================================================
+// Payload, 4 bytes: [0] LinkCommandId, [1] arg, [2..3] value, u16 LE.
+// Every command is a state to be in, not a step to take, but re-applying
+// one still isn't free (a second STOP restarts the stopped state and its
+// wander pause), so the Galileo ACKs a repeat of the last SEQ within
+// LINK_DUP_WINDOW_MS without applying it again.
+//   STOP           stop now; wander restarts after its usual pause
+//   SET_SPEED      value = percent of the configured cruise/turn speed
+//   PAUSE_WANDER   value 1 = stop wandering and stay stopped, 0 = resume
+//   SET_THRESHOLD  arg = LinkThreshold, value in its unit, 0 = config.h default
+
+#define LINK_COMMAND_LEN      4
+#define LINK_SPEED_MIN_PCT    10
+#define LINK_SPEED_MAX_PCT    150
+// SET_THRESHOLD values other than 0; both ends check (the ESP32 refuses,
+// the Galileo clamps)
+#define LINK_COLLISION_CM_MIN 5
+#define LINK_COLLISION_CM_MAX 400     // RANGE_MAX_MM, nothing reads further
+#define LINK_TTC_MS_MIN       100
+#define LINK_TTC_MS_MAX       5000
+
+enum LinkCommandId : uint8_t {
+    CMD_STOP = 1,
+    CMD_SET_SPEED,
+    CMD_PAUSE_WANDER,
+    CMD_SET_THRESHOLD,
+    CMD_COUNT
+};
+
+enum LinkThreshold : uint8_t {
+    THRESH_COLLISION_CM = 0,    // hard floor on the filtered distance
+    THRESH_TTC_MS,              // time-to-impact trigger
+    THRESH_COUNT
+};
+
+struct LinkCommand {
+    uint8_t id;
+    uint8_t arg;
+    uint16_t value;
+};
+
+inline uint8_t linkEncodeCommand(uint8_t* out, const LinkCommand& c) {
+    out[0] = c.id;
+    out[1] = c.arg;
+    out[2] = c.value & 0xFF;
+    out[3] = c.value >> 8;
+    return LINK_COMMAND_LEN;
+}
+
+// False for a short payload or an id/threshold this build doesn't know
+inline bool linkDecodeCommand(const uint8_t* p, uint8_t len, LinkCommand& c) {
+    if (len < LINK_COMMAND_LEN) return false;
+    c.id = p[0];
+    c.arg = p[1];
+    c.value = p[2] | (p[3] << 8);
+    if (c.id == 0 || c.id >= CMD_COUNT) return false;
+    return c.id != CMD_SET_THRESHOLD || c.arg < THRESH_COUNT;
+}
+
+// Incremental parser: push() bytes as they arrive, then drain next().
+// A bad length or CRC drops only the sync byte it started at and rescans
+// what is already buffered, so a corrupted frame costs at most itself.
+class LinkParser {
+public:
+    LinkParser() : n_(0), crcErrors_(0), skipped_(0) {}
+
+    void push(uint8_t b) {
+        if (n_ == LINK_FRAME_MAX) drop(1);  // can't happen if next() is drained
+        buf_[n_++] = b;
+    }
+
+    bool next(LinkFrame& f) {
+        for (;;) {
+            uint8_t i = 0;
+            while (i < n_ && buf_[i] != LINK_SYNC) i++;
+            if (i > 0) {
+                skipped_ += i;
+                drop(i);
+            }
+            if (n_ < LINK_HEADER_LEN) return false;
+
+            uint8_t len = buf_[3];
+            if (len > LINK_MAX_PAYLOAD) {
+                crcErrors_++;
+                drop(1);
+                continue;
+            }
+            uint8_t total = LINK_HEADER_LEN + len + 1;
+            if (n_ < total) return false;
+            if (linkCrc8(buf_ + 1, total - 2) != buf_[total - 1]) {
+                crcErrors_++;
+                drop(1);
+                continue;
+            }
+            f.type = buf_[1];
+            f.seq = buf_[2];
+            f.len = len;
+            memcpy(f.payload, buf_ + LINK_HEADER_LEN, len);
+            drop(total);
+            return true;
+        }
+    }
+
+    uint16_t crcErrors() const { return crcErrors_; }   // bad length or CRC
+    uint16_t skipped() const { return skipped_; }       // noise bytes outside frames
+
+private:
+    void drop(uint8_t k) {
+        memmove(buf_, buf_ + k, n_ - k);
+        n_ -= k;
+    }
+
+    uint8_t buf_[LINK_FRAME_MAX];
+    uint8_t n_;
+    uint16_t crcErrors_;
+    uint16_t skipped_;
+};
+
+#endif
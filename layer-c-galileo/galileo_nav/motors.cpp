@@ -1,61 +1,232 @@
 #include "motors.h"
 #include "config.h"
+#include "tick_timer.h"
+#include "wheel_control.h"
+#include "link_protocol.h"
+#include "fast_pin.h"
 #include <Arduino.h>
 
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+#define LEFT   0
+#define RIGHT  1
+
 static bool _moving = false;
 
+static const uint8_t fwdPin[2] = { PIN_MOTOR_LEFT_FWD, PIN_MOTOR_RIGHT_FWD };
+static const uint8_t bckPin[2] = { PIN_MOTOR_LEFT_BCK, PIN_MOTOR_RIGHT_BCK };
+static int16_t appliedDuty[2] = { 0, 0 };
+
+// Pins checked and resolved at compile time (fast_pin.h)
+typedef HBridge<PIN_MOTOR_LEFT_FWD, PIN_MOTOR_LEFT_BCK> LeftBridge;
+typedef HBridge<PIN_MOTOR_RIGHT_FWD, PIN_MOTOR_RIGHT_BCK> RightBridge;
+
+static uint8_t speedPct = 100;
+static int16_t baseTarget[2] = { 0, 0 };    // before speedPct
+
+static WheelController wheels[2];
+static bool encodersOk = false;
+static unsigned long lastUpdateMs = 0;
+
+// Sign = direction. Only touches the pins when the duty actually changes.
+static void applyDuty(uint8_t w, int16_t duty) {
+    if (duty == appliedDuty[w]) return;
+    appliedDuty[w] = duty;
+    if (w == LEFT) LeftBridge::drive(duty);
+    else RightBridge::drive(duty);
+}
+
+// =============================================================
+// ENCODERS
+// =============================================================
+// x4 quadrature counts per wheel, kept by an interrupt (or on the UNO the
+// Timer2 tick). The motor task takes the difference once per period; the
+// int16 counters only need to not wrap twice in between.
+
+#ifdef WHEEL_ENCODERS
+static volatile int16_t encCount[2] = { 0, 0 };
+static volatile uint8_t encAB[2] = { 0, 0 };
+static int16_t encSeen[2] = { 0, 0 };
+static int32_t odometry[2] = { 0, 0 };
+
+#if defined(ESP32)
+    static portMUX_TYPE encMux = portMUX_INITIALIZER_UNLOCKED;
+    #define ENC_LOCK()         portENTER_CRITICAL(&encMux)
+    #define ENC_UNLOCK()       portEXIT_CRITICAL(&encMux)
+    #define ENC_LOCK_ISR()     portENTER_CRITICAL_ISR(&encMux)
+    #define ENC_UNLOCK_ISR()   portEXIT_CRITICAL_ISR(&encMux)
+#else
+    // int16 reads aren't atomic on the AVR
+    #define ENC_LOCK()         noInterrupts()
+    #define ENC_UNLOCK()       interrupts()
+    #define ENC_LOCK_ISR()
+    #define ENC_UNLOCK_ISR()
+#endif
+
+static const uint8_t encPin[4] = { PIN_ENC_LEFT_A, PIN_ENC_LEFT_B, PIN_ENC_RIGHT_A, PIN_ENC_RIGHT_B };
+
+// Straight port reads (fast_pin.h), the pins fixed per wheel at compile
+// time: these run in interrupts, where digitalRead() would take ~15 us
+template<uint8_t A, uint8_t B> static inline uint8_t readAB() {
+    return (FastPin<A>::read() ? 2 : 0) | (FastPin<B>::read() ? 1 : 0);
+}
+static inline uint8_t readLeftAB() { return readAB<PIN_ENC_LEFT_A, PIN_ENC_LEFT_B>(); }
+static inline uint8_t readRightAB() { return readAB<PIN_ENC_RIGHT_A, PIN_ENC_RIGHT_B>(); }
+
+static inline void encoderStep(uint8_t w, uint8_t ab) {
+    encCount[w] += QUAD_STEP[(encAB[w] << 2) | ab];
+    encAB[w] = ab;
+}
+
+#ifdef ENCODERS_FROM_TICK
+// 9.6 kHz from the Timer2 ISR, every 104 us
+static volatile bool encReady = false;   // the tick may already be running
+
+void encoderTick() {
+    if (!encReady) return;
+    encoderStep(LEFT, readLeftAB());
+    encoderStep(RIGHT, readRightAB());
+}
+#else
+static void IRAM_ATTR onLeftEncoder() {
+    ENC_LOCK_ISR();
+    encoderStep(LEFT, readLeftAB());
+    ENC_UNLOCK_ISR();
+}
+
+static void IRAM_ATTR onRightEncoder() {
+    ENC_LOCK_ISR();
+    encoderStep(RIGHT, readRightAB());
+    ENC_UNLOCK_ISR();
+}
+#endif
+
+static bool setupEncoders() {
+    for (uint8_t i = 0; i < 4; i++) pinMode(encPin[i], INPUT_PULLUP);
+    encAB[LEFT] = readLeftAB();
+    encAB[RIGHT] = readRightAB();
+#ifdef ENCODERS_FROM_TICK
+    encReady = true;
+    startTickTimer();
+#else
+    for (uint8_t i = 0; i < 4; i++) {
+        int irq = digitalPinToInterrupt(encPin[i]);
+#ifdef NOT_AN_INTERRUPT
+        if (irq == NOT_AN_INTERRUPT) {
+            Serial.println("MOTORS: ENCODER PIN HAS NO INTERRUPT, RUNNING OPEN LOOP");
+            return false;
+        }
+#endif
+        attachInterrupt(irq, i < 2 ? onLeftEncoder : onRightEncoder, CHANGE);
+    }
+#endif
+    return true;
+}
+
+// Counts since the last call; also keeps the running odometry
+static int16_t takeCounts(uint8_t w) {
+    ENC_LOCK();
+    int16_t c = encCount[w];
+    ENC_UNLOCK();
+    int16_t d = c - encSeen[w];
+    encSeen[w] = c;
+    odometry[w] += d;
+    return d;
+}
+#endif
+
+// =============================================================
+// SPEED CONTROL
+// =============================================================
+
+static int16_t openLoopDuty(int16_t target) {
+    int16_t d = (int32_t)MOTOR_OPEN_LOOP_DUTY * speedPct / 100;
+    if (d > 255) d = 255;
+    return target > 0 ? d : target < 0 ? -d : 0;
+}
+
+static void setTargets(int16_t left, int16_t right) {
+    baseTarget[LEFT] = left;
+    baseTarget[RIGHT] = right;
+    _moving = left != 0 || right != 0;
+    for (uint8_t w = 0; w < 2; w++) {
+        wheels[w].setTarget((int32_t)baseTarget[w] * speedPct / 100);
+        // Open loop (or a stop, which shouldn't wait for the next period)
+        if (!encodersOk || !_moving) applyDuty(w, openLoopDuty(baseTarget[w]));
+    }
+}
+
+void setSpeedPercent(uint16_t pct) {
+    if (pct < LINK_SPEED_MIN_PCT) pct = LINK_SPEED_MIN_PCT;
+    if (pct > LINK_SPEED_MAX_PCT) pct = LINK_SPEED_MAX_PCT;
+    speedPct = pct;
+    setTargets(baseTarget[LEFT], baseTarget[RIGHT]);
+}
+
 void setupMotors() {
-    pinMode(PIN_MOTOR_LEFT_FWD, OUTPUT);
-    pinMode(PIN_MOTOR_LEFT_BCK, OUTPUT);
-    pinMode(PIN_MOTOR_RIGHT_FWD, OUTPUT);
-    pinMode(PIN_MOTOR_RIGHT_BCK, OUTPUT);
+    for (uint8_t w = 0; w < 2; w++) {
+        pinMode(fwdPin[w], OUTPUT);
+        pinMode(bckPin[w], OUTPUT);
+        digitalWrite(fwdPin[w], LOW);
+        digitalWrite(bckPin[w], LOW);
+    }
+#ifdef WHEEL_ENCODERS
+    encodersOk = setupEncoders();
+#endif
+    lastUpdateMs = millis();
     stopMotors();
 }
 
+void updateMotors(unsigned long now) {
+    unsigned long gap = now - lastUpdateMs;
+    uint16_t dt = gap > 0xFFFF ? 0xFFFF : (uint16_t)gap;  // no wrap to a short period
+    lastUpdateMs = now;
+#ifdef WHEEL_ENCODERS
+    if (!encodersOk) return;
+    for (uint8_t w = 0; w < 2; w++) {
+        int16_t counts = takeCounts(w);
+        applyDuty(w, wheels[w].update(counts, dt));
+    }
+#endif
+}
+
 void moveForward() {
-    digitalWrite(PIN_MOTOR_LEFT_BCK, LOW);
-    digitalWrite(PIN_MOTOR_RIGHT_BCK, LOW);
-    // ESP32 Arduino Core 3.0+ supports analogWrite.
-    // Use 150-200 for speed (0-255).
-    analogWrite(PIN_MOTOR_LEFT_FWD, 200); 
-    analogWrite(PIN_MOTOR_RIGHT_FWD, 200);
-    _moving = true;
+    setTargets(WHEEL_CRUISE_TPS, WHEEL_CRUISE_TPS);
 }
 
 void stopMotors() {
-    digitalWrite(PIN_MOTOR_LEFT_FWD, LOW);
-    digitalWrite(PIN_MOTOR_LEFT_BCK, LOW);
-    digitalWrite(PIN_MOTOR_RIGHT_FWD, LOW);
-    digitalWrite(PIN_MOTOR_RIGHT_BCK, LOW);
-    _moving = false;
+    setTargets(0, 0);
 }
 
 void moveBackward() {
-    digitalWrite(PIN_MOTOR_LEFT_FWD, LOW);
-    digitalWrite(PIN_MOTOR_RIGHT_FWD, LOW);
-    analogWrite(PIN_MOTOR_LEFT_BCK, 200);
-    analogWrite(PIN_MOTOR_RIGHT_BCK, 200);
-    _moving = true;
+    setTargets(-WHEEL_CRUISE_TPS, -WHEEL_CRUISE_TPS);
 }
 
 void turnLeft() {
     // Pivot turn: Left Back, Right Fwd
-    digitalWrite(PIN_MOTOR_LEFT_FWD, LOW);
-    analogWrite(PIN_MOTOR_LEFT_BCK, 200);
-    digitalWrite(PIN_MOTOR_RIGHT_BCK, LOW);
-    analogWrite(PIN_MOTOR_RIGHT_FWD, 200);
-    _moving = true;
+    setTargets(-WHEEL_TURN_TPS, WHEEL_TURN_TPS);
 }
 
 void turnRight() {
     // Pivot turn: Left Fwd, Right Back
-    digitalWrite(PIN_MOTOR_LEFT_BCK, LOW);
-    analogWrite(PIN_MOTOR_LEFT_FWD, 200);
-    digitalWrite(PIN_MOTOR_RIGHT_FWD, LOW);
-    analogWrite(PIN_MOTOR_RIGHT_BCK, 200);
-    _moving = true;
+    setTargets(WHEEL_TURN_TPS, -WHEEL_TURN_TPS);
 }
 
 bool isMoving() {
     return _moving;
 }
+
+bool wheelsStalled() {
+    return encodersOk && (wheels[LEFT].stalled() || wheels[RIGHT].stalled());
+}
+
+void wheelOdometry(int32_t& left, int32_t& right) {
+#ifdef WHEEL_ENCODERS
+    left = odometry[LEFT];
+    right = odometry[RIGHT];
+#else
+    left = right = 0;
+#endif
+}
@@ -1,6 +1,8 @@
 #ifndef MOTORS_H
 #define MOTORS_H
 
+#include <stdint.h>
+
 void setupMotors();
 void moveForward();
 void stopMotors();
@@ -10,6 +12,22 @@ void turnRight();
 // Add other movements as necessary (turnLeft, turnRight, etc.)
 // For this demo, random movement logic will be in main
 
+// One speed-control period (PI per wheel); call every MOTOR_PERIOD_MS.
+// The move functions above only set the target speeds.
+void updateMotors(unsigned long now);
+
+// Scales every motion's speed (closed loop) or duty (open loop), in percent
+// of the configured values; LINK_SPEED_MIN_PCT..LINK_SPEED_MAX_PCT. Takes
+// effect on the current motion too.
+void setSpeedPercent(uint16_t pct);
+
 bool isMoving();
 
+// A wheel is commanded to turn but its encoder says it isn't (see
+// wheel_control.h). Always false without encoders.
+bool wheelsStalled();
+
+// Encoder ticks since boot, signed (forward = up)
+void wheelOdometry(int32_t& left, int32_t& right);
+
 #endif
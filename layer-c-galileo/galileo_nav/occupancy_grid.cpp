@@ -0,0 +1,130 @@
+#include "occupancy_grid.h"
+#include <string.h>
+
+#define GRID_MASK  (GRID_SIZE - 1)
+
+// Unexplored floor is worth the most; a blocked cell ends the direction
+static const uint8_t CELL_SCORE[4] = { 2, 4, 1, 0 };   // unknown, seen, visited, blocked
+#define PLAN_TURN_COST  2                             // per 1/16 turn
+// A blocked cell is only cleared by an echo from at least this far past it
+#define PLAN_CLEAR_MARGIN_MM  (3 * GRID_CELL_MM)
+
+void OccupancyGrid::clear() {
+    memset(bits_, 0, sizeof(bits_));
+    originX_ = originY_ = -GRID_SIZE / 2;
+}
+
+int16_t OccupancyGrid::cellOf(int32_t mm) {
+    return (int16_t)(mm >= 0 ? mm / GRID_CELL_MM : -((-mm + GRID_CELL_MM - 1) / GRID_CELL_MM));
+}
+
+CellState OccupancyGrid::get(int16_t cx, int16_t cy) const {
+    if ((uint16_t)(cx - originX_) >= GRID_SIZE || (uint16_t)(cy - originY_) >= GRID_SIZE) return CELL_UNKNOWN;
+    uint16_t i = ((uint16_t)(cy & GRID_MASK) << GRID_SIZE_LOG2) | (cx & GRID_MASK);
+    return (CellState)((bits_[i >> 2] >> ((i & 3) * 2)) & 3);
+}
+
+// Seen never overwrites what the rover found out first hand, unless
+// `force` (a blocked cell the sonar now sees through)
+void OccupancyGrid::set(int16_t cx, int16_t cy, CellState s, bool force) {
+    if ((uint16_t)(cx - originX_) >= GRID_SIZE || (uint16_t)(cy - originY_) >= GRID_SIZE) return;
+    uint16_t i = ((uint16_t)(cy & GRID_MASK) << GRID_SIZE_LOG2) | (cx & GRID_MASK);
+    uint8_t shift = (i & 3) * 2;
+    uint8_t& b = bits_[i >> 2];
+    if (s == CELL_SEEN && !force && ((b >> shift) & 3) != CELL_UNKNOWN) return;
+    b = (b & ~(3 << shift)) | (s << shift);
+}
+
+void OccupancyGrid::clearColumn(int16_t cx) {
+    for (uint8_t y = 0; y < GRID_SIZE; y++) {
+        uint16_t i = ((uint16_t)y << GRID_SIZE_LOG2) | (cx & GRID_MASK);
+        bits_[i >> 2] &= ~(3 << ((i & 3) * 2));
+    }
+}
+
+void OccupancyGrid::clearRow(int16_t cy) {
+    // A row is GRID_SIZE / 4 whole bytes
+    memset(bits_ + ((cy & GRID_MASK) << (GRID_SIZE_LOG2 - 2)), 0, GRID_SIZE / 4);
+}
+
+// Re-centres the window on (cx, cy) once the rover nears an edge. The
+// columns/rows that drop off one side come back as the new far side, empty.
+void OccupancyGrid::scrollTo(int16_t cx, int16_t cy) {
+    int16_t dx = cx - originX_, dy = cy - originY_;
+    if (dx < GRID_MARGIN || dx >= GRID_SIZE - GRID_MARGIN) {
+        int16_t to = cx - GRID_SIZE / 2;
+        if (to - originX_ >= GRID_SIZE || originX_ - to >= GRID_SIZE) {
+            for (uint8_t x = 0; x < GRID_SIZE; x++) clearColumn(x);
+        } else {
+            for (int16_t x = originX_; x < to; x++) clearColumn(x);                          // left behind moving +x
+            for (int16_t x = to + GRID_SIZE; x < originX_ + GRID_SIZE; x++) clearColumn(x);  // moving -x
+        }
+        originX_ = to;
+    }
+    if (dy < GRID_MARGIN || dy >= GRID_SIZE - GRID_MARGIN) {
+        int16_t to = cy - GRID_SIZE / 2;
+        if (to - originY_ >= GRID_SIZE || originY_ - to >= GRID_SIZE) {
+            memset(bits_, 0, sizeof(bits_));
+        } else {
+            for (int16_t y = originY_; y < to; y++) clearRow(y);
+            for (int16_t y = to + GRID_SIZE; y < originY_ + GRID_SIZE; y++) clearRow(y);
+        }
+        originY_ = to;
+    }
+}
+
+CellState OccupancyGrid::at(int32_t xMm, int32_t yMm) const {
+    return get(cellOf(xMm), cellOf(yMm));
+}
+
+void OccupancyGrid::visit(int32_t xMm, int32_t yMm) {
+    int16_t cx = cellOf(xMm), cy = cellOf(yMm);
+    scrollTo(cx, cy);
+    set(cx, cy, CELL_VISITED);
+}
+
+void OccupancyGrid::observe(int32_t xMm, int32_t yMm, Angle heading, uint16_t distMm, uint16_t maxMm) {
+    int16_t c = cosQ14(heading), s = sinQ14(heading);
+    // Half-cell steps so the ray doesn't jump a cell corner to corner. A
+    // blocked cell the echo came from well past is free again (whatever it
+    // was moved, or the mark was odometry drift); near the end of the ray
+    // it's more likely the beam edge clipping the same obstacle.
+    for (uint16_t d = 0; d + GRID_CELL_MM / 2 < distMm; d += GRID_CELL_MM / 2) {
+        int16_t cx = cellOf(xMm + (((int32_t)d * c) >> 14)), cy = cellOf(yMm + (((int32_t)d * s) >> 14));
+        bool through = (uint32_t)d + PLAN_CLEAR_MARGIN_MM < distMm;
+        set(cx, cy, CELL_SEEN, through && get(cx, cy) == CELL_BLOCKED);
+    }
+    if (distMm < maxMm) markBlocked(xMm + (((int32_t)distMm * c) >> 14), yMm + (((int32_t)distMm * s) >> 14));
+}
+
+void OccupancyGrid::markBlocked(int32_t xMm, int32_t yMm) {
+    set(cellOf(xMm), cellOf(yMm), CELL_BLOCKED);
+}
+
+Angle OccupancyGrid::pickHeading(int32_t xMm, int32_t yMm, Angle heading, uint8_t jitter) const {
+    Angle best = heading + 32768;   // boxed in on every side: turn round
+    int16_t bestScore = INT16_MIN;
+    for (uint8_t n = 0; n < PLAN_DIRECTIONS; n++) {
+        uint8_t k = (n + jitter) % PLAN_DIRECTIONS;
+        Angle dir = heading + (Angle)(k * (65536UL / PLAN_DIRECTIONS));
+        int16_t c = cosQ14(dir), s = sinQ14(dir);
+        int16_t score = 0;
+        for (uint8_t i = 1; i <= PLAN_REACH_CELLS; i++) {
+            int32_t d = (int32_t)i * GRID_CELL_MM;
+            CellState st = at(xMm + ((d * c) >> 14), yMm + ((d * s) >> 14));
+            if (st == CELL_BLOCKED) {
+                if (i <= 2) score = -1;   // no room to even start
+                break;
+            }
+            score += CELL_SCORE[st];
+        }
+        if (score < 0) continue;  // blocked right in front
+        uint8_t turn = k <= PLAN_DIRECTIONS / 2 ? k : PLAN_DIRECTIONS - k;
+        score = score * 4 - turn * PLAN_TURN_COST;
+        if (score > bestScore) {
+            bestScore = score;
+            best = dir;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,65 @@
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <stdint.h>
+#include "dead_reckoning.h"
+
+// Coverage map around the rover, 2 bits a cell in a fixed
+// GRID_SIZE x GRID_SIZE window that scrolls with it: 32 x 32 cells of 15 cm
+// (4.8 m across) is 256 bytes, which the UNO's 2 KB can spare. Positions are
+// mm from the boot pose (dead_reckoning.h). Cells wrap into the window as a
+// ring, so a scroll only clears the rows/columns that fall off the far side;
+// anything outside the window reads as unknown.
+// No Arduino dependencies (host/nav_sim runs it through the sketch).
+
+#define GRID_SIZE_LOG2    5
+#define GRID_SIZE         (1 << GRID_SIZE_LOG2)
+#define GRID_CELL_MM      150
+#define GRID_MARGIN       (GRID_SIZE / 4)   // re-centre when the rover is this close to an edge
+
+#define PLAN_DIRECTIONS   16
+#define PLAN_REACH_CELLS  10                // how far out a direction is scored
+
+enum CellState : uint8_t {
+    CELL_UNKNOWN = 0,
+    CELL_SEEN,          // the sonar saw through it, not driven over yet
+    CELL_VISITED,       // the rover has been here
+    CELL_BLOCKED        // echo or bump
+};
+
+class OccupancyGrid {
+public:
+    OccupancyGrid() { clear(); }
+    void clear();
+
+    CellState at(int32_t xMm, int32_t yMm) const;
+
+    // The rover is here: keeps the window around it, marks the cell visited
+    void visit(int32_t xMm, int32_t yMm);
+
+    // Range reading from (x, y) along heading: seen up to distMm, blocked
+    // there unless it's maxMm (nothing in range). Blocked cells well short
+    // of distMm are cleared, so marks don't outlive what made them.
+    void observe(int32_t xMm, int32_t yMm, Angle heading, uint16_t distMm, uint16_t maxMm);
+
+    void markBlocked(int32_t xMm, int32_t yMm);
+
+    // Wander planner: of PLAN_DIRECTIONS headings, the one with the most
+    // floor not yet driven over before the first blocked cell, less a small
+    // cost per step of turning away from `heading`. Directions blocked
+    // right in front are out. `jitter` picks which of equal scores wins.
+    Angle pickHeading(int32_t xMm, int32_t yMm, Angle heading, uint8_t jitter) const;
+
+private:
+    static int16_t cellOf(int32_t mm);
+    CellState get(int16_t cx, int16_t cy) const;
+    void set(int16_t cx, int16_t cy, CellState s, bool force = false);
+    void scrollTo(int16_t cx, int16_t cy);
+    void clearColumn(int16_t cx);
+    void clearRow(int16_t cy);
+
+    uint8_t bits_[GRID_SIZE * GRID_SIZE / 4];
+    int16_t originX_, originY_;     // world cell at the window's low corner
+};
+
+#endif
@@ -0,0 +1,82 @@
+#include "range_filter.h"
+
+void RangeFilter::reset() {
+    head_ = 0;
+    count_ = 0;
+    emaQ8_ = 0;
+    speedQ8_ = 0;
+    lastMs_ = 0;
+    periodMs_ = 0;
+}
+
+// Sound covers 0.1715 mm per microsecond of round trip; 0.1715 * 65536 = 11240.
+// Replaces `duration * 0.034 / 2` (soft-float on the AVR).
+uint16_t RangeFilter::echoToMm(uint16_t echoUs) {
+    if (echoUs == 0) return RANGE_MAX_MM;
+    uint32_t mm = ((uint32_t)echoUs * 11240UL) >> 16;
+    return mm > RANGE_MAX_MM ? RANGE_MAX_MM : (uint16_t)mm;
+}
+
+// Insertion sort of at most RANGE_WINDOW values; cheaper than anything clever
+uint16_t RangeFilter::median() const {
+    uint16_t v[RANGE_WINDOW];
+    for (uint8_t i = 0; i < count_; i++) {
+        uint16_t x = raw_[i];
+        int8_t j = i - 1;
+        while (j >= 0 && v[j] > x) {
+            v[j + 1] = v[j];
+            j--;
+        }
+        v[j + 1] = x;
+    }
+    return v[count_ / 2];
+}
+
+void RangeFilter::add(uint16_t echoUs, uint32_t nowMs) {
+    if (count_ > 0 && nowMs - lastMs_ > RANGE_STALE_MS) reset();  // e.g. after a stop
+
+    raw_[head_] = echoToMm(echoUs);
+    head_ = (head_ + 1) % RANGE_WINDOW;
+    if (count_ < RANGE_WINDOW) count_++;
+
+    int32_t m = (int32_t)median() << 8;
+    if (count_ == 1) {
+        emaQ8_ = m;  // first ping: nothing to smooth against
+        lastMs_ = nowMs;
+        return;
+    }
+
+    int32_t prev = emaQ8_;
+    emaQ8_ += (m - emaQ8_) >> RANGE_EMA_SHIFT;
+
+    uint32_t dt = nowMs - lastMs_;
+    lastMs_ = nowMs;
+    if (dt == 0) return;
+    periodMs_ = dt;
+    int32_t instant = (prev - emaQ8_) * 1000 / (int32_t)dt;   // mm/s, Q8
+    speedQ8_ += (instant - speedQ8_) >> RANGE_SPEED_SHIFT;
+}
+
+// Group delay in pings: RANGE_WINDOW / 2 for the median, (1 - a) / a for the EMA
+#define RANGE_LAG_PINGS  (RANGE_WINDOW / 2 + (1 << RANGE_EMA_SHIFT) - 1)
+
+uint16_t RangeFilter::predictedMm() const {
+    int16_t v = closingMmPerS();
+    if (v <= 0) return distanceMm();
+    uint32_t lead = (uint32_t)v * periodMs_ * RANGE_LAG_PINGS / 1000;
+    return lead >= distanceMm() ? 0 : distanceMm() - lead;
+}
+
+uint16_t RangeFilter::timeToCollisionMs() const {
+    int16_t v = closingMmPerS();
+    if (v <= 0) return RANGE_NO_TTC;
+    uint32_t ms = (uint32_t)predictedMm() * 1000UL / (uint16_t)v;
+    return ms >= RANGE_NO_TTC ? RANGE_NO_TTC - 1 : (uint16_t)ms;
+}
+
+bool RangeFilter::collisionAhead(uint32_t minMm, uint16_t ttcMs, int16_t minClosing) const {
+    // Not until a single bad echo can't be the median any more
+    if (count_ < RANGE_WINDOW / 2 + 1) return false;
+    if (predictedMm() < minMm) return true;
+    return closingMmPerS() >= minClosing && timeToCollisionMs() < ttcMs;
+}
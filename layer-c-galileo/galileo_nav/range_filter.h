@@ -0,0 +1,53 @@
+#ifndef RANGE_FILTER_H
+#define RANGE_FILTER_H
+
+#include <stdint.h>
+
+// Ultrasonic post-processing, integer only (no FPU on the AVR):
+//   echo width -> mm -> median of the last RANGE_WINDOW pings (drops single
+//   bad echoes) -> EMA (smooths jitter) -> closing speed -> time to collision.
+// No Arduino dependencies, so host/filter_replay.cpp can run recorded traces
+// through exactly this code.
+
+#define RANGE_WINDOW      5      // pings in the median window (odd)
+#define RANGE_EMA_SHIFT   1      // EMA weight 1/2 on the new median
+#define RANGE_SPEED_SHIFT 1      // EMA weight 1/2 on the new speed estimate
+#define RANGE_MAX_MM      4000   // no echo / out of range reads as this
+#define RANGE_STALE_MS    500    // gap after which history is dropped
+#define RANGE_NO_TTC      0xFFFF
+
+class RangeFilter {
+public:
+    RangeFilter() { reset(); }
+    void reset();
+
+    // One ping: echo pulse width (0 = no echo) and when it was taken
+    void add(uint16_t echoUs, uint32_t nowMs);
+
+    bool ready() const { return count_ > 0; }
+    uint16_t distanceMm() const { return (uint16_t)(emaQ8_ >> 8); }
+    int16_t closingMmPerS() const { return (int16_t)(speedQ8_ >> 8); }  // > 0: approaching
+    // The median and EMA each trail the true range by a few pings; while
+    // closing, this is the smoothed distance minus that lag
+    uint16_t predictedMm() const;
+    uint16_t timeToCollisionMs() const;                                  // RANGE_NO_TTC if not closing
+
+    // Closer than minMm, or closing faster than minClosing with less than
+    // ttcMs to go
+    bool collisionAhead(uint32_t minMm, uint16_t ttcMs, int16_t minClosing) const;
+
+    static uint16_t echoToMm(uint16_t echoUs);
+
+private:
+    uint16_t median() const;
+
+    uint16_t raw_[RANGE_WINDOW];   // ring of converted pings, mm
+    uint8_t head_;
+    uint8_t count_;
+    int32_t emaQ8_;                // mm, 24.8 fixed point
+    int32_t speedQ8_;              // mm/s, 24.8 fixed point
+    uint32_t lastMs_;
+    uint16_t periodMs_;            // last ping interval
+};
+
+#endif
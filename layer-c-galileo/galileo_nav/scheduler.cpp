@@ -0,0 +1,65 @@
+#include "scheduler.h"
+
+struct Task {
+    TaskFn fn;
+    unsigned long nextMs;
+    TaskStats stats;
+};
+
+static Task tasks[SCHED_MAX_TASKS];
+static uint8_t numTasks = 0;
+static TaskFn tickHook = NULL;
+
+void addTask(const char* name, TaskFn fn, uint16_t periodMs) {
+    if (numTasks >= SCHED_MAX_TASKS) return;
+    Task& t = tasks[numTasks++];
+    t.fn = fn;
+    t.nextMs = millis();
+    t.stats.name = name;
+    t.stats.periodMs = periodMs;
+    t.stats.lastUs = 0;
+    t.stats.maxUs = 0;
+    t.stats.overruns = 0;
+    t.stats.runs = 0;
+}
+
+void setTickHook(TaskFn fn) {
+    tickHook = fn;
+}
+
+void runScheduler() {
+    bool hookRan = false;
+    for (uint8_t i = 0; i < numTasks; i++) {
+        Task& t = tasks[i];
+        unsigned long now = millis();
+        if ((long)(now - t.nextMs) < 0) continue;
+        if (!hookRan) {
+            hookRan = true;
+            if (tickHook) tickHook(now);
+        }
+
+        // A whole period late means at least one slot was lost: count it
+        // and re-phase instead of running a burst of catch-up calls
+        if (now - t.nextMs >= t.stats.periodMs) {
+            if (t.stats.overruns < 0xFFFF) t.stats.overruns++;
+            t.nextMs = now;
+        }
+        t.nextMs += t.stats.periodMs;
+
+        unsigned long start = micros();
+        t.fn(now);
+        unsigned long us = micros() - start;
+        t.stats.lastUs = us > 0xFFFF ? 0xFFFF : us;
+        if (t.stats.lastUs > t.stats.maxUs) t.stats.maxUs = t.stats.lastUs;
+        t.stats.runs++;
+    }
+}
+
+uint8_t taskCount() { return numTasks; }
+const TaskStats& taskStats(uint8_t i) { return tasks[i].stats; }
+
+uint16_t totalOverruns() {
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < numTasks; i++) n += tasks[i].stats.overruns;
+    return n > 0xFFFF ? 0xFFFF : n;
+}
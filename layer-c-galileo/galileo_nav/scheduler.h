@@ -0,0 +1,38 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// Cooperative fixed-rate scheduler. Each task runs every periodMs from
+// loop(); tasks must return quickly (no delay(), no pulseIn()). Registration
+// order is run order within a tick, so sense -> nav -> motor -> events.
+
+#define SCHED_MAX_TASKS  6
+
+typedef void (*TaskFn)(unsigned long nowMs);
+
+struct TaskStats {
+    const char* name;
+    uint16_t periodMs;
+    uint16_t lastUs;        // execution time of the last run
+    uint16_t maxUs;         // worst execution time since boot
+    uint16_t overruns;      // runs that started a whole period (or more) late
+    uint32_t runs;
+};
+
+void addTask(const char* name, TaskFn fn, uint16_t periodMs);
+
+// Runs once per tick (a runScheduler() pass with at least one task due),
+// before any of the tasks. For work that must be in place before sense/nav
+// see the world, e.g. applying ESP32 commands; latency is at most the
+// shortest task period.
+void setTickHook(TaskFn fn);
+
+// Runs every task that is due; call from loop() as often as possible
+void runScheduler();
+
+uint8_t taskCount();
+const TaskStats& taskStats(uint8_t i);
+uint16_t totalOverruns();
+
+#endif
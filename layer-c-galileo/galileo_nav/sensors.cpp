@@ -1,57 +1,468 @@
 #include "sensors.h"
 #include "config.h"
+#include "range_filter.h"
+#include "tick_timer.h"
+#include "link_protocol.h"
+#include "motors.h"
+#include "fast_pin.h"
 #include <Arduino.h>
 
-void setupSensors() {
-    pinMode(PIN_ULTRASONIC_TRIG, OUTPUT);
-    pinMode(PIN_ULTRASONIC_ECHO, INPUT);
-    pinMode(PIN_BUMP_LEFT, INPUT_PULLUP);
-    pinMode(PIN_BUMP_RIGHT, INPUT_PULLUP);
-    pinMode(PIN_RESET_BUTTON, INPUT_PULLUP);
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+static long _lastDistance = -1;
+static uint16_t collisionCm = COLLISION_DIST_CM;
+static uint16_t collisionTtcMs = COLLISION_TTC_MS;
+
+// =============================================================
+// ULTRASONIC ARRAY (interrupt driven, staggered)
+// =============================================================
+// The forward sensor plus whichever of front-left / front-right / rear
+// config.h wires up. Sensors that could hear each other's pings take turns:
+// the period is split into one slot per forward-facing sensor (the rear one
+// shares the forward one's slot, they face apart) and a timer fires the
+// next slot every ULTRASONIC_PERIOD_MS / slots, so each sensor still pings
+// once per ULTRASONIC_PERIOD_MS. An echo that isn't back when the next slot
+// fires counts as nothing in range; a neighbour's ping can't end it early.
+// The price is range: the slot is the longest round trip (20 ms or 3.4 m
+// with three slots).
+// A sensor whose echo pin has no interrupt is left out altogether (not
+// pinged, no slot, not counted by sonarCount()): with nothing to end its
+// ping it would read as a permanently clear path.
+// A CHANGE interrupt per echo pin timestamps both edges. The pulse width
+// lands in that sensor's double buffer: the ISR fills the back slot and
+// flips the index, so updateRange() never sees a half-written value and
+// never waits.
+
+#define NO_ECHO 0
+
+struct SonarMount {
+    uint8_t trig, echo;
+    int16_t angleDeg;   // CCW from straight ahead
+    uint8_t slot;
+};
+
+static const SonarMount SONARS[] = {
+    { PIN_ULTRASONIC_TRIG, PIN_ULTRASONIC_ECHO, 0, 0 },
+#ifdef PIN_SONAR_LEFT_TRIG
+    { PIN_SONAR_LEFT_TRIG, PIN_SONAR_LEFT_ECHO, SONAR_SIDE_DEG, 1 },
+#endif
+#ifdef PIN_SONAR_RIGHT_TRIG
+    { PIN_SONAR_RIGHT_TRIG, PIN_SONAR_RIGHT_ECHO, -SONAR_SIDE_DEG, 2 },
+#endif
+#ifdef PIN_SONAR_REAR_TRIG
+    { PIN_SONAR_REAR_TRIG, PIN_SONAR_REAR_ECHO, 180, 0 },
+#endif
+};
+
+#define SONAR_COUNT  (sizeof(SONARS) / sizeof(SONARS[0]))
+#define SONAR_MAX    4
+
+struct EchoSample {
+    uint16_t us;        // pulse width, NO_ECHO if nothing came back
+    uint32_t ms;        // when the ping completed
+};
+
+struct EchoState {
+    volatile EchoSample buf[2];
+    volatile uint8_t front;
+    volatile uint8_t seq;           // bumped per completed ping
+    uint8_t seen;                   // last seq fed to the filter
+    uint32_t seenMs;                // ...and when that ping completed
+    volatile unsigned long start;
+    volatile bool high;
+    volatile bool pending;          // triggered, no falling edge yet
+};
+
+static EchoState echoes[SONAR_COUNT];
+static RangeFilter ranges[SONAR_COUNT];
+static uint8_t active[SONAR_COUNT];     // SONARS index of each enabled sensor
+static uint8_t activeSlot[SONAR_COUNT]; // its slot, renumbered without gaps
+static uint8_t activeCount = 0;
+static uint8_t slotCount = 1;
+static uint8_t slotMs = ULTRASONIC_PERIOD_MS;
+static uint8_t nextSlot = 0;
+
+#if defined(ESP32)
+    #include <esp_timer.h>
+    // Timer callback (esp_timer task) and GPIO ISR can run on different cores
+    static portMUX_TYPE echoMux = portMUX_INITIALIZER_UNLOCKED;
+    #define ECHO_LOCK()    portENTER_CRITICAL_ISR(&echoMux)
+    #define ECHO_UNLOCK()  portEXIT_CRITICAL_ISR(&echoMux)
+#else
+    // AVR ISRs don't nest; the loop-driven trigger masks interrupts itself
+    #define ECHO_LOCK()
+    #define ECHO_UNLOCK()
+#endif
+
+static void publishEcho(EchoState& e, uint16_t us) {
+    volatile EchoSample& back = e.buf[e.front ^ 1];
+    back.us = us;
+    back.ms = millis();
+    e.front ^= 1;
+    e.seq++;
+    e.pending = false;
+}
+
+static void IRAM_ATTR onEcho(uint8_t i) {
+    unsigned long t = micros();
+    EchoState& e = echoes[i];
+    ECHO_LOCK();
+    if (digitalRead(SONARS[i].echo) == HIGH) {
+        e.start = t;
+        e.high = true;
+    } else if (e.high && e.pending) {
+        unsigned long width = t - e.start;
+        publishEcho(e, width > 0xFFFF ? NO_ECHO : (uint16_t)width);
+        e.high = false;
+    }
+    ECHO_UNLOCK();
 }
 
-long readUltrasonicDistance() {
-    digitalWrite(PIN_ULTRASONIC_TRIG, LOW);
-    delayMicroseconds(2);
-    digitalWrite(PIN_ULTRASONIC_TRIG, HIGH);
+static void IRAM_ATTR onEcho0() { onEcho(0); }
+static void IRAM_ATTR onEcho1() { onEcho(1); }
+static void IRAM_ATTR onEcho2() { onEcho(2); }
+static void IRAM_ATTR onEcho3() { onEcho(3); }
+
+// Timer context. Closes the slot before (a ping still out reads as
+// "nothing in range") and triggers this slot's sensors together.
+static void fireTrigger() {
+    uint8_t slot = nextSlot;
+    nextSlot = slot + 1 < slotCount ? slot + 1 : 0;
+    ECHO_LOCK();
+    for (uint8_t k = 0; k < activeCount; k++) {
+        EchoState& e = echoes[active[k]];
+        if (e.pending) publishEcho(e, NO_ECHO);
+        if (activeSlot[k] == slot) {
+            e.high = false;
+            e.pending = true;
+        }
+    }
+    ECHO_UNLOCK();
+    for (uint8_t k = 0; k < activeCount; k++) {
+        if (activeSlot[k] == slot) digitalWrite(SONARS[active[k]].trig, HIGH);
+    }
     delayMicroseconds(10);
-    digitalWrite(PIN_ULTRASONIC_TRIG, LOW);
-    
-    // Timeout of 30ms (approx 5m)
-    long duration = pulseIn(PIN_ULTRASONIC_ECHO, HIGH, 30000); 
-    if (duration == 0) return 999; // No echo -> far away
-    
-    // Speed of sound 340 m/s -> 0.034 cm/us. Divide by 2 (round trip).
-    return (duration * 0.034 / 2);
+    for (uint8_t k = 0; k < activeCount; k++) {
+        if (activeSlot[k] == slot) digitalWrite(SONARS[active[k]].trig, LOW);
+    }
+}
+
+#if defined(HAVE_TICK_TIMER)
+static uint8_t triggerMs = 0;
+
+// Timer2 interrupt, every millisecond (tick_timer.cpp)
+void ultrasonicMsTick() {
+    if (++triggerMs < slotMs) return;
+    triggerMs = 0;
+    fireTrigger();
+}
+
+static void startTriggerTimer() {
+    startTickTimer();
+}
+#define TRIGGER_FROM_TIMER
+#elif defined(ESP32)
+static esp_timer_handle_t triggerTimer = NULL;
+
+static void startTriggerTimer() {
+    esp_timer_create_args_t args = {};
+    args.callback = [](void*) { fireTrigger(); };
+    args.name = "ultrasonic";
+    esp_timer_create(&args, &triggerTimer);
+    esp_timer_start_periodic(triggerTimer, slotMs * 1000UL);
+}
+#define TRIGGER_FROM_TIMER
+#else
+// No timer we can claim portably (Galileo): trigger from checkCollision()
+// once the slot is up. Still only a 10 us pulse, the echo is measured
+// by the interrupt either way.
+static unsigned long lastTriggerMs = 0;
+
+static void pollTrigger() {
+    unsigned long now = millis();
+    if (now - lastTriggerMs < slotMs) return;
+    lastTriggerMs = now;
+    noInterrupts();
+    fireTrigger();
+    interrupts();
+}
+#endif
+
+static void setupUltrasonic() {
+    static_assert(SONAR_COUNT <= SONAR_MAX, "one echo handler per sensor, add more");
+    void (*handlers[SONAR_MAX])() = { onEcho0, onEcho1, onEcho2, onEcho3 };
+    bool slotUsed[SONAR_MAX] = { false };
+    for (uint8_t i = 0; i < SONAR_COUNT; i++) {
+        pinMode(SONARS[i].trig, OUTPUT);
+        digitalWrite(SONARS[i].trig, LOW);
+        pinMode(SONARS[i].echo, INPUT);
+        int irq = digitalPinToInterrupt(SONARS[i].echo);
+#ifdef NOT_AN_INTERRUPT
+        if (irq == NOT_AN_INTERRUPT) {
+            Serial.print("SENSORS: ECHO PIN ");
+            Serial.print(SONARS[i].echo);
+            if (i == 0) {
+                Serial.println(" HAS NO INTERRUPT, ULTRASONIC DISABLED");
+                return;
+            }
+            Serial.println(" HAS NO INTERRUPT, SENSOR LEFT OUT");
+            continue;
+        }
+#endif
+        attachInterrupt(irq, handlers[i], CHANGE);
+        slotUsed[SONARS[i].slot] = true;
+        active[activeCount++] = i;
+    }
+    // Slots of sensors that were left out don't take a turn
+    uint8_t renumber[SONAR_MAX];
+    slotCount = 0;
+    for (uint8_t s = 0; s < SONAR_MAX; s++) {
+        if (slotUsed[s]) renumber[s] = slotCount++;
+    }
+    for (uint8_t k = 0; k < activeCount; k++) activeSlot[k] = renumber[SONARS[active[k]].slot];
+    slotMs = ULTRASONIC_PERIOD_MS / slotCount;
+#ifdef TRIGGER_FROM_TIMER
+    startTriggerTimer();
+#endif
+}
+
+// Feeds each sensor's latest completed ping (if there is a new one) to its
+// filter. Pings the loop was too slow to see are skipped; a filter only
+// needs the newest one and its timestamp.
+static void updateRange() {
+#ifndef TRIGGER_FROM_TIMER
+    pollTrigger();
+#endif
+    for (uint8_t k = 0; k < activeCount; k++) {
+        uint8_t i = active[k];
+        EchoState& e = echoes[i];
+        uint8_t seq = e.seq;
+        if (seq == e.seen) continue;
+        e.seen = seq;
+        uint8_t front = e.front;
+        uint16_t us = e.buf[front].us;
+        uint32_t ms = e.buf[front].ms;
+#ifdef RANGE_TRACE
+        // Recording for host/filter_replay: "R,<ms>,<us>" per forward ping
+        if (i == 0) {
+            Serial.print("R,");
+            Serial.print(ms);
+            Serial.print(",");
+            Serial.println(us);
+        }
+#endif
+        ranges[i].add(us, ms);
+        e.seenMs = ms;
+    }
+    if (ranges[0].ready()) _lastDistance = ranges[0].distanceMm() / 10;
+}
+
+// =============================================================
+// BUMPERS / RESET BUTTON (debounced, edge latched)
+// =============================================================
+// Every accepted press bumps a counter and is timestamped, so a hit that
+// comes and goes while the loop is busy is still seen on the next check.
+// The first edge is taken at once (no added latency); edges within
+// INPUT_DEBOUNCE_MS of it are bounce. On the AVR the 1 kHz tick samples
+// the pins (SoftwareSerial owns every pin-change vector on the UNO);
+// elsewhere a CHANGE interrupt per pin does it.
+
+#define INPUT_BUMP_LEFT   0
+#define INPUT_BUMP_RIGHT  1
+#define INPUT_RESET       2
+#define INPUT_COUNT       3
+
+struct InputLatch {
+    uint8_t pin;                        // active LOW, pulled up
+    volatile bool pressed;              // debounced level
+    volatile uint8_t presses;           // accepted press edges, wraps
+    volatile unsigned long changedMs;   // last accepted edge
+};
+
+static InputLatch inputs[INPUT_COUNT] = {
+    { PIN_BUMP_LEFT, false, 0, 0 },
+    { PIN_BUMP_RIGHT, false, 0, 0 },
+    { PIN_RESET_BUTTON, false, 0, 0 }
+};
+
+// Each consumer keeps its own copy of the press counters it has seen
+static uint8_t seenByCollision[2] = { 0, 0 };
+static uint8_t seenByReader[BUMPER_READERS][2] = { { 0, 0 }, { 0, 0 } };
+static uint8_t seenByReset = 0;
+
+#if defined(ESP32)
+    static portMUX_TYPE inputMux = portMUX_INITIALIZER_UNLOCKED;
+    #define INPUT_LOCK()       portENTER_CRITICAL(&inputMux)
+    #define INPUT_UNLOCK()     portEXIT_CRITICAL(&inputMux)
+    #define INPUT_LOCK_ISR()   portENTER_CRITICAL_ISR(&inputMux)
+    #define INPUT_UNLOCK_ISR() portEXIT_CRITICAL_ISR(&inputMux)
+#else
+    #define INPUT_LOCK()       noInterrupts()
+    #define INPUT_UNLOCK()     interrupts()
+    #define INPUT_LOCK_ISR()
+    #define INPUT_UNLOCK_ISR()
+#endif
+
+// Interrupt (or tick) context, or the task side with INPUT_LOCK held
+static void IRAM_ATTR inputEdge(InputLatch& in, bool level, unsigned long now) {
+    if (level == in.pressed) return;
+    if (now - in.changedMs < INPUT_DEBOUNCE_MS) return;  // bounce
+    in.pressed = level;
+    in.changedMs = now;
+    if (level) in.presses++;
+}
+
+static bool takePress(uint8_t i, uint8_t& seen) {
+    uint8_t p = inputs[i].presses;
+    bool hit = p != seen;
+    seen = p;
+    return hit;
+}
+
+// Interrupt-side reads go straight to the port (fast_pin.h), so the pin is
+// a template argument rather than inputs[i].pin
+template<uint8_t Pin> static inline bool pinLow() { return !FastPin<Pin>::read(); }
+
+#if defined(HAVE_TICK_TIMER)
+#define INPUTS_FROM_TICK
+
+// Timer2 interrupt, every millisecond (tick_timer.cpp)
+void inputsMsTick() {
+    unsigned long now = millis();
+    inputEdge(inputs[INPUT_BUMP_LEFT], pinLow<PIN_BUMP_LEFT>(), now);
+    inputEdge(inputs[INPUT_BUMP_RIGHT], pinLow<PIN_BUMP_RIGHT>(), now);
+    inputEdge(inputs[INPUT_RESET], pinLow<PIN_RESET_BUTTON>(), now);
+}
+
+static void resyncInputs() {}
+#else
+static void IRAM_ATTR onInput(uint8_t i, bool level) {
+    INPUT_LOCK_ISR();
+    inputEdge(inputs[i], level, millis());
+    INPUT_UNLOCK_ISR();
+}
+
+static void IRAM_ATTR onBumpLeft() { onInput(INPUT_BUMP_LEFT, pinLow<PIN_BUMP_LEFT>()); }
+static void IRAM_ATTR onBumpRight() { onInput(INPUT_BUMP_RIGHT, pinLow<PIN_BUMP_RIGHT>()); }
+static void IRAM_ATTR onResetButton() { onInput(INPUT_RESET, pinLow<PIN_RESET_BUTTON>()); }
+
+// An edge that landed inside the debounce window gets no interrupt after
+// it; pick up the settled level once the window is over. Also the only
+// path for a pin without an interrupt.
+static void resyncInputs() {
+    for (uint8_t i = 0; i < INPUT_COUNT; i++) {
+        bool level = digitalRead(inputs[i].pin) == LOW;
+        unsigned long now = millis();
+        INPUT_LOCK();
+        inputEdge(inputs[i], level, now);
+        INPUT_UNLOCK();
+    }
+}
+#endif
+
+static void setupInputs() {
+    for (uint8_t i = 0; i < INPUT_COUNT; i++) pinMode(inputs[i].pin, INPUT_PULLUP);
+#ifdef INPUTS_FROM_TICK
+    startTickTimer();
+#else
+    void (*handlers[INPUT_COUNT])() = { onBumpLeft, onBumpRight, onResetButton };
+    for (uint8_t i = 0; i < INPUT_COUNT; i++) {
+        int irq = digitalPinToInterrupt(inputs[i].pin);
+#ifdef NOT_AN_INTERRUPT
+        if (irq == NOT_AN_INTERRUPT) continue;  // polled by resyncInputs()
+#endif
+        attachInterrupt(irq, handlers[i], CHANGE);
+    }
+#endif
+}
+
+void setupSensors() {
+    setupInputs();
+    setupUltrasonic();
 }
 
 bool checkCollision() {
-    // 0. Simulation / Debug via Serial
+    // 0. Simulation / Debug via Serial (not when Serial is the ESP32 link:
+    // this would eat frame bytes)
+#ifndef LINK_ON_DEBUG_SERIAL
     if (Serial.available()) {
         char c = Serial.read();
         if (c == 'c' || c == 'C') return true; // Type 'c' to simulate collision
     }
+#endif
 
-    // 1. Check Bump Switches (Active LOW usually)
-    if (digitalRead(PIN_BUMP_LEFT) == LOW) return true;
-    if (digitalRead(PIN_BUMP_RIGHT) == LOW) return true;
+    // 1. Bump Switches: held now, or hit (even briefly) since the last check
+    resyncInputs();
+    bool bumped = false;
+    for (uint8_t i = INPUT_BUMP_LEFT; i <= INPUT_BUMP_RIGHT; i++) {
+        if (takePress(i, seenByCollision[i]) || inputs[i].pressed) bumped = true;
+    }
+    if (bumped) return true;
 
-    // 2. Check Ultrasonic
-    long distance = readUltrasonicDistance();
-    if (distance < COLLISION_DIST_CM && distance > 0) {
+    // 2. Check Ultrasonic: filtered distance, or about to hit something at
+    // the current closing speed, on any sensor facing forward
+    updateRange();
+    uint32_t minMm = (uint32_t)collisionCm * 10;
+    if (ranges[0].collisionAhead(minMm, collisionTtcMs, COLLISION_MIN_CLOSING_MM_S)) {
         return true;
     }
+    for (uint8_t k = 1; k < activeCount; k++) {
+        uint8_t i = active[k];
+        if (SONARS[i].angleDeg < -90 || SONARS[i].angleDeg > 90) continue;
+        if (ranges[i].ready() && ranges[i].distanceMm() < minMm) return true;
+    }
 
     return false;
 }
 
+// Clamped again here, whatever the ESP32 let through
+void setCollisionDistanceCm(uint16_t cm) {
+    collisionCm = !cm ? COLLISION_DIST_CM : cm < LINK_COLLISION_CM_MIN ? LINK_COLLISION_CM_MIN
+                : cm > LINK_COLLISION_CM_MAX ? LINK_COLLISION_CM_MAX : cm;
+}
+
+void setCollisionTtcMs(uint16_t ms) {
+    collisionTtcMs = !ms ? COLLISION_TTC_MS : ms < LINK_TTC_MS_MIN ? LINK_TTC_MS_MIN
+                   : ms > LINK_TTC_MS_MAX ? LINK_TTC_MS_MAX : ms;
+}
+
 bool checkStuck() {
-    // Requires encoders or current sensing to be accurate.
-    // For this prototype, we will return false unless explicitly implemented.
-    // Or we can simulate random stuck events if enabled for testing.
-    return false; 
+    // Encoder stall detection (motors.cpp): commanded speed, wheel not turning
+    return wheelsStalled();
+}
+
+long lastDistanceCm() {
+    return _lastDistance;
+}
+
+uint8_t sonarCount() {
+    return activeCount;
+}
+
+int16_t sonarAngleDeg(uint8_t i) {
+    return SONARS[active[i]].angleDeg;
+}
+
+bool sonarReading(uint8_t i, uint16_t& mm, uint32_t& ms) {
+    if (i >= activeCount || !ranges[active[i]].ready()) return false;
+    mm = ranges[active[i]].distanceMm();
+    ms = echoes[active[i]].seenMs;
+    return true;
+}
+
+uint8_t bumperBits(BumperReader r) {
+    uint8_t* seen = seenByReader[r];
+    uint8_t bits = 0;
+    if (takePress(INPUT_BUMP_LEFT, seen[0]) || inputs[INPUT_BUMP_LEFT].pressed) bits |= TLM_BUMP_LEFT;
+    if (takePress(INPUT_BUMP_RIGHT, seen[1]) || inputs[INPUT_BUMP_RIGHT].pressed) bits |= TLM_BUMP_RIGHT;
+    return bits;
 }
 
 bool checkReset() {
-    return (digitalRead(PIN_RESET_BUTTON) == LOW);
+    // A tap shorter than a sense period still counts as one press
+    resyncInputs();
+    bool tapped = takePress(INPUT_RESET, seenByReset);
+    return tapped || inputs[INPUT_RESET].pressed;
 }
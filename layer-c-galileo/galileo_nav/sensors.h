@@ -1,17 +1,44 @@
 #ifndef SENSORS_H
 #define SENSORS_H
 
+#include <stdint.h>
+
 // Initialize sensor pins
 void setupSensors();
 
-// Returns true if a collision is detected (bump or ultrasonic)
+// Returns true if a collision is detected (bump or ultrasonic). A bump
+// that came and went since the last call counts.
 bool checkCollision();
 
-// Returns true if wheels are spinning but not moving (stuck)
-// (Mocked for now or needs encoders)
+// Runtime overrides of COLLISION_DIST_CM / COLLISION_TTC_MS; 0 = default,
+// others clamped to LINK_COLLISION_CM_* / LINK_TTC_MS_* (link_protocol.h)
+void setCollisionDistanceCm(uint16_t cm);
+void setCollisionTtcMs(uint16_t ms);
+
+// Last ultrasonic reading taken by checkCollision(), -1 if none yet
+long lastDistanceCm();
+
+// Ultrasonic array (config.h): sensor 0 is the forward one above, then
+// front-left, front-right and rear, whichever are wired up to an echo pin
+// with an interrupt (the others aren't counted; none if the forward one isn't)
+uint8_t sonarCount();
+int16_t sonarAngleDeg(uint8_t i);   // mounting angle, CCW from straight ahead
+// Filtered distance in mm (RANGE_MAX_MM: nothing in range) and when its
+// latest ping completed (millis); false until the first one
+bool sonarReading(uint8_t i, uint16_t& mm, uint32_t& ms);
+
+// Bumper switches as TLM_BUMP_LEFT | TLM_BUMP_RIGHT bits (link_protocol.h):
+// pressed now or since this reader's previous call. Each reader has its own
+// latch, so a tap the sense task has taken still reaches the slower
+// telemetry frame.
+enum BumperReader { BUMPERS_NAV, BUMPERS_TELEMETRY, BUMPER_READERS };
+uint8_t bumperBits(BumperReader r);
+
+// Returns true if a wheel is driven but not turning (stuck), from the
+// wheel encoders; always false when they're not fitted
 bool checkStuck();
 
-// Returns true if reset button is pressed
+// Returns true if reset button is pressed, or was tapped since the last call
 bool checkReset();
 
 #endif
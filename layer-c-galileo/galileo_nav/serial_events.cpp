@@ -1,5 +1,6 @@
 #include "serial_events.h"
 #include "config.h"
+#include "link_protocol.h"
 
 #ifdef USE_SOFTWARE_SERIAL
     SoftwareSerial EspSerial(PIN_RX_FROM_ESP, PIN_TX_TO_ESP);
@@ -8,16 +9,343 @@
     #define COMM_PORT ESP_SERIAL
 #endif
 
+#include "tick_timer.h"
+#include "fast_pin.h"
+
+// On the ESP32 build the link *is* the USB port, so debug text competes
+// with frames for the same wire and goes through the TX queue too
+#ifdef LINK_ON_DEBUG_SERIAL
+    #define DEBUG_ON_LINK
+#endif
+
+// Send order, [0] is the head. Critical events (eventPriority()) line up
+// ahead of informational ones; only the head is ever on the wire.
+static NavEvent queue[EVENT_TX_QUEUE];
+static uint8_t queueCount = 0;
+
+static uint8_t txSeq = 0;
+static bool inFlight = false;        // queue head sent, waiting for its ACK
+static uint8_t inFlightSeq = 0;
+static uint8_t attempts = 0;
+static unsigned long sentAt = 0;
+
+static uint8_t telemetrySeq = 0;     // own counter so the ESP32 can spot gaps
+static uint8_t telemetryCount = 0;
+static uint16_t telemetryPrevCm = TELEMETRY_NO_DISTANCE;
+
+// Decoded commands wait here for the top of the next scheduler tick
+static LinkCommand cmdRing[CMD_RX_RING];
+static uint8_t cmdHead = 0, cmdCount = 0;
+
+// Last command applied, so a retransmission (our ACK got lost) isn't
+static bool cmdApplied = false;
+static uint8_t cmdAppliedSeq = 0;
+static unsigned long cmdAppliedMs = 0;
+
+static LinkParser parser;
+static LinkTxStats stats = {0, 0, 0, 0, 0, 0, 0};
+
+// =============================================================
+// TX QUEUE
+// =============================================================
+// Whole frames (or debug lines) wait in priority slots; callers never touch
+// the port. Highest priority goes out first. When every slot is taken the
+// lowest-priority waiting entry is evicted, so a COLLISION can push out
+// debug text or telemetry but never the other way round.
+
+struct TxSlot {
+    uint8_t len;            // 0 = free
+    uint8_t prio;
+    uint8_t order;          // FIFO within a priority
+    uint8_t data[TX_SLOT_BYTES];
+};
+
+static TxSlot slots[TX_SLOTS];
+static uint8_t nextOrder = 0;
+
+// Slot being transmitted. Written by pumpSerialTx() only while txActive is
+// false; the drain (bit-bang ISR or pump) owns it until it clears txActive.
+static TxSlot* volatile txCur = NULL;
+static volatile uint8_t txPos = 0;
+static volatile bool txActive = false;
+
+static bool enqueue(const uint8_t* data, uint8_t len, uint8_t prio) {
+    if (len > TX_SLOT_BYTES) len = TX_SLOT_BYTES;
+    TxSlot* victim = NULL;
+    for (uint8_t i = 0; i < TX_SLOTS; i++) {
+        TxSlot& s = slots[i];
+        // On the wire. txCur still points at the last frame once it's out,
+        // and that slot is as free as any other.
+        if (txActive && &s == txCur) continue;
+        if (s.len == 0) { victim = &s; break; }
+        // Lowest priority, oldest first among equals. Telemetry and debug
+        // may also replace their own kind: the newest reading is the useful one.
+        bool evictable = prio < TX_EVENT ? s.prio <= prio : s.prio < prio;
+        if (evictable && (!victim || s.prio < victim->prio ||
+            (s.prio == victim->prio && (uint8_t)(s.order - victim->order) > 0x80))) {
+            victim = &s;
+        }
+    }
+    if (!victim) {
+        stats.txDropped++;
+        return false;
+    }
+    if (victim->len != 0) stats.txDropped++;  // evicted something lower
+    memcpy(victim->data, data, len);
+    victim->prio = prio;
+    victim->order = nextOrder++;
+    victim->len = len;
+    return true;
+}
+
+static TxSlot* pickNext() {
+    TxSlot* best = NULL;
+    for (uint8_t i = 0; i < TX_SLOTS; i++) {
+        TxSlot& s = slots[i];
+        if (s.len == 0) continue;
+        if (!best || s.prio > best->prio ||
+            (s.prio == best->prio && (uint8_t)(s.order - best->order) > 0x80)) {
+            best = &s;
+        }
+    }
+    return best;
+}
+
+#ifdef USE_SOFTWARE_SERIAL
+// Bit-banged 8N1 from the Timer2 tick (one call per bit time). SoftwareSerial
+// is kept for RX only: its write() masks interrupts for ~1 ms per byte.
+// Its RX does the same while a byte comes in, and a tick held up that long
+// stretches whatever bit is on the wire. So TX only starts a byte once the
+// ESP32 has been quiet for TX_QUIET_BITS, and a late tick mid-byte drops the
+// frame back to idle and sends it again from the top (the ESP32's parser
+// resyncs on the CRC).
+#define TX_BIT_US      (1000000UL / SERIAL_BAUD_RATE)
+#define TX_QUIET_BITS  20
+
+static volatile uint8_t bitState = 0;   // 0 idle, 1-8 data bits, 9 stop
+static volatile uint8_t bitByte = 0;
+static uint8_t rxQuiet = 0;             // bit times since the ESP32 last sent
+static unsigned long lastBitUs = 0;
+
+void linkTxBitTick() {
+    unsigned long t = micros();
+    bool late = t - lastBitUs > TX_BIT_US * 3 / 2;
+    lastBitUs = t;
+    if (late || !FastPin<PIN_RX_FROM_ESP>::read()) rxQuiet = 0;
+    else if (rxQuiet < TX_QUIET_BITS) rxQuiet++;
+    if (late && bitState != 0) {
+        FastPin<PIN_TX_TO_ESP>::write(true);    // idle, then the frame again
+        bitState = 0;
+        txPos = 0;
+        return;
+    }
+    switch (bitState) {
+        case 0:
+            if (!txActive) return;
+            if (txPos >= txCur->len) {
+                txCur->len = 0;     // frame done, slot free
+                txActive = false;
+                return;
+            }
+            if (rxQuiet < TX_QUIET_BITS) return;    // the ESP32 is talking
+            bitByte = txCur->data[txPos++];
+            FastPin<PIN_TX_TO_ESP>::write(false);   // start bit
+            bitState = 1;
+            return;
+        case 9:
+            FastPin<PIN_TX_TO_ESP>::write(true);    // stop bit, held until the next start
+            bitState = 0;
+            return;
+        default:
+            FastPin<PIN_TX_TO_ESP>::write((bitByte >> (bitState - 1)) & 1);
+            bitState++;
+            return;
+    }
+}
+#endif
+
+void pumpSerialTx() {
+    if (!txActive) {
+        txCur = pickNext();
+        if (!txCur) return;
+        txPos = 0;
+        txActive = true;
+    }
+#ifndef USE_SOFTWARE_SERIAL
+    // Hardware UART: only what fits its TX buffer, its interrupt does the rest
+    while (txActive && COMM_PORT.availableForWrite() > 0) {
+        COMM_PORT.write(txCur->data[txPos++]);
+        if (txPos >= txCur->len) {
+            txCur->len = 0;
+            txActive = false;
+        }
+    }
+#endif
+}
+
+static void writeFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t len, uint8_t prio) {
+    uint8_t frame[LINK_FRAME_MAX];
+    uint8_t n = linkEncode(frame, type, seq, payload, len);
+    enqueue(frame, n, prio);
+}
+
+static void debugLine(const char* prefix, const char* text) {
+#ifdef DEBUG_ON_LINK
+    char line[TX_SLOT_BYTES];
+    uint8_t n = snprintf(line, sizeof(line) - 2, "%s%s", prefix, text);
+    if (n > sizeof(line) - 3) n = sizeof(line) - 3;
+    line[n++] = '\r';
+    line[n++] = '\n';
+    enqueue((const uint8_t*)line, n, TX_DEBUG);
+#else
+    Serial.print(prefix);
+    Serial.println(text);
+#endif
+}
+
+static uint8_t eventPriority(NavEvent ev) {
+    return (ev == NAV_COLLISION || ev == NAV_STUCK || ev == NAV_RESET) ? TX_CRITICAL : TX_EVENT;
+}
+
 void setupSerialEvents() {
     COMM_PORT.begin(SERIAL_BAUD_RATE);
-    delay(100);
+#ifdef USE_SOFTWARE_SERIAL
+    pinMode(PIN_TX_TO_ESP, OUTPUT);
+    digitalWrite(PIN_TX_TO_ESP, HIGH);  // idle
+    startTickTimer();
+#endif
+}
+
+// The head stays put while it waits for its ACK (its seq is on the wire)
+static uint8_t firstWaiting() {
+    return inFlight ? 1 : 0;
+}
+
+static void removeEvent(uint8_t i) {
+    memmove(&queue[i], &queue[i + 1], (queueCount - i - 1) * sizeof(NavEvent));
+    queueCount--;
+}
+
+void sendEvent(NavEvent ev) {
+    if (ev == NAV_NONE) return;
+    bool critical = eventPriority(ev) == TX_CRITICAL;
+    if (queueCount >= EVENT_TX_QUEUE) {
+        // Full (ESP32 slow or gone): the oldest waiting informational event
+        // makes room. Only a queue of nothing but critical ones turns the
+        // new event away.
+        uint8_t victim = queueCount;
+        for (uint8_t i = firstWaiting(); i < queueCount; i++) {
+            if (eventPriority(queue[i]) != TX_CRITICAL) { victim = i; break; }
+        }
+        stats.dropped++;
+        if (victim == queueCount) return;
+        removeEvent(victim);
+    }
+    // Critical: behind the head and earlier critical events, ahead of the rest
+    uint8_t at = queueCount;
+    if (critical) {
+        at = firstWaiting();
+        while (at < queueCount && eventPriority(queue[at]) == TX_CRITICAL) at++;
+    }
+    memmove(&queue[at + 1], &queue[at], (queueCount - at) * sizeof(NavEvent));
+    queue[at] = ev;
+    queueCount++;
+    // Debug output to main USB serial as well
+    debugLine("DEBUG SENT: ", navEventName(ev));
 }
 
-void sendEvent(const char* eventName) {
-    if (eventName != NULL) {
-        COMM_PORT.println(eventName);
-        // Debug output to main USB serial as well
-        Serial.print("DEBUG SENT: ");
-        Serial.println(eventName);
+// Fixed-rate state frame for the ESP32 (not acknowledged: the next one is
+// 50 ms away). Distance is delta-coded against the previous frame.
+void sendTelemetry(const LinkTelemetry& t) {
+    uint8_t payload[LINK_MAX_PAYLOAD];
+    bool keyframe = telemetryCount++ % TELEMETRY_KEYFRAME_EVERY == 0;
+    uint8_t n = linkEncodeTelemetry(payload, t, keyframe, telemetryPrevCm);
+    telemetryPrevCm = t.distanceCm;
+    writeFrame(LINK_TELEMETRY, telemetrySeq++, payload, n, TX_TELEMETRY);
+}
+
+static void popEvent() {
+    removeEvent(0);
+    inFlight = false;
+}
+
+// =============================================================
+// RX
+// =============================================================
+
+static void handleCommandFrame(const LinkFrame& f) {
+    LinkCommand c;
+    if (!linkDecodeCommand(f.payload, f.len, c)) {
+        // ACK anyway: resending a command this build can't read won't help
+        stats.badCommands++;
+        writeFrame(LINK_ACK, f.seq, NULL, 0, TX_CRITICAL);
+        return;
+    }
+    unsigned long now = millis();
+    if (cmdApplied && f.seq == cmdAppliedSeq && now - cmdAppliedMs < LINK_DUP_WINDOW_MS) {
+        writeFrame(LINK_ACK, f.seq, NULL, 0, TX_CRITICAL);
+        return;
+    }
+    // Full ring: no ACK, so the ESP32 resends once there's room
+    if (cmdCount >= CMD_RX_RING) return;
+    cmdRing[(cmdHead + cmdCount) % CMD_RX_RING] = c;
+    cmdCount++;
+    stats.commands++;
+    cmdApplied = true;
+    cmdAppliedSeq = f.seq;
+    cmdAppliedMs = now;
+    writeFrame(LINK_ACK, f.seq, NULL, 0, TX_CRITICAL);
+}
+
+void pumpSerialRx() {
+    // Bounded by the port's own RX buffer (64 bytes on the AVR cores)
+    while (COMM_PORT.available()) {
+        parser.push((uint8_t)COMM_PORT.read());
+        LinkFrame f;
+        while (parser.next(f)) {
+            if (f.type == LINK_ACK && inFlight && f.seq == inFlightSeq) {
+                stats.sent++;
+                popEvent();
+            } else if (f.type == LINK_COMMAND) {
+                handleCommandFrame(f);
+            }
+        }
     }
+    stats.crcErrors = parser.crcErrors();
+}
+
+bool nextCommand(LinkCommand& c) {
+    if (cmdCount == 0) return false;
+    c = cmdRing[cmdHead];
+    cmdHead = (cmdHead + 1) % CMD_RX_RING;
+    cmdCount--;
+    return true;
+}
+
+void serviceSerialEvents(unsigned long now) {
+    if (queueCount == 0) return;
+    if (inFlight) {
+        if (now - sentAt < LINK_ACK_TIMEOUT_MS) return;
+        if (attempts > LINK_MAX_RETRIES) {
+            debugLine("DEBUG LINK: NO ACK ", navEventName(queue[0]));
+            stats.dropped++;
+            popEvent();
+            if (queueCount == 0) return;
+        } else {
+            stats.retries++;
+        }
+    }
+    if (!inFlight) {
+        inFlight = true;
+        inFlightSeq = txSeq++;
+        attempts = 0;
+    }
+    uint8_t id = queue[0];
+    writeFrame(LINK_EVENT, inFlightSeq, &id, 1, eventPriority(queue[0]));
+    attempts++;
+    sentAt = now;
+}
+
+LinkTxStats linkTxStats() {
+    return stats;
 }
@@ -2,8 +2,58 @@
 #define SERIAL_EVENTS_H
 
 #include <Arduino.h>
+#include "events.h"
+#include "link_protocol.h"
+
+// Framed link to the ESP32 (see link_protocol.h). Events are queued and
+// delivered reliably: resent every LINK_ACK_TIMEOUT_MS until ACKed, up to
+// LINK_MAX_RETRIES times, one at a time. COLLISION, STUCK and RESET jump
+// the informational events still waiting, and evict the oldest of them if
+// the queue is full. Nothing here blocks on the port: frames wait in a
+// small priority queue that pumpSerialTx() (or, on the UNO, the Timer2
+// bit-bang interrupt) drains.
+
+#define EVENT_TX_QUEUE  8
+#define TX_SLOTS        6       // frames waiting for the wire
+#define TX_SLOT_BYTES   28      // >= LINK_FRAME_MAX; debug lines are cut to fit
+#define CMD_RX_RING     4       // decoded ESP32 commands not yet applied
+
+// Who wins a full TX queue
+enum TxPriority {
+    TX_DEBUG = 0,
+    TX_TELEMETRY,
+    TX_EVENT,
+    TX_CRITICAL     // COLLISION, STUCK, RESET
+};
+
+struct LinkTxStats {
+    uint16_t sent;          // events ACKed
+    uint16_t retries;       // retransmissions
+    uint16_t dropped;       // events given up on (no ACK), or pushed out of / refused by a full event queue
+    uint16_t crcErrors;     // bad frames received from the ESP32
+    uint16_t txDropped;     // TX entries evicted or refused by priority
+    uint16_t commands;      // commands received and queued
+    uint16_t badCommands;   // command frames this build couldn't decode
+};
 
 void setupSerialEvents();
-void sendEvent(const char* eventName);
+void sendEvent(NavEvent ev);
+void sendTelemetry(const LinkTelemetry& t);
+
+// Queues (re)transmissions of the head of the event queue. Call from the
+// event task.
+void serviceSerialEvents(unsigned long now);
+
+// Parses whatever the port has buffered: event ACKs are handled at once,
+// commands are ACKed and queued for nextCommand(). Call every loop() pass.
+void pumpSerialRx();
+
+// Oldest command not yet applied; false if none
+bool nextCommand(LinkCommand& c);
+
+// Feeds queued frames to the port without blocking. Call every loop() pass.
+void pumpSerialTx();
+
+LinkTxStats linkTxStats();
 
 #endif
@@ -0,0 +1,45 @@
+#include "tick_timer.h"
+
+#ifdef HAVE_TICK_TIMER
+
+// clk/8 for the bit clock (16 MHz / 8 / 208 = 9615 Hz, 0.2% off 9600),
+// clk/64 for a plain 1 kHz tick
+#if TICK_HZ > 4000
+    #define TICK_PRESCALE  8
+    #define TICK_CS        _BV(CS21)
+#else
+    #define TICK_PRESCALE  64
+    #define TICK_CS        _BV(CS22)
+#endif
+
+static bool started = false;
+static uint16_t msAccum = 0;   // fractional ms tick when TICK_HZ isn't a multiple of 1000
+
+ISR(TIMER2_COMPA_vect) {
+#ifdef USE_SOFTWARE_SERIAL
+    linkTxBitTick();   // first, so bit edges jitter as little as possible
+#endif
+#ifdef ENCODERS_FROM_TICK
+    encoderTick();
+#endif
+    msAccum += 1000;
+    if (msAccum >= TICK_HZ) {
+        msAccum -= TICK_HZ;
+        ultrasonicMsTick();
+        inputsMsTick();
+    }
+}
+
+void startTickTimer() {
+    if (started) return;
+    started = true;
+    noInterrupts();
+    TCCR2A = _BV(WGM21);           // CTC
+    TCCR2B = TICK_CS;
+    OCR2A = (F_CPU / TICK_PRESCALE / TICK_HZ) - 1;
+    TCNT2 = 0;
+    TIMSK2 = _BV(OCIE2A);
+    interrupts();
+}
+
+#endif
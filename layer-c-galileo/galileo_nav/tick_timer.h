@@ -0,0 +1,35 @@
+#ifndef TICK_TIMER_H
+#define TICK_TIMER_H
+
+#include "config.h"
+
+// AVR only: one Timer2 compare interrupt shared by everything that needs a
+// hardware tick. Timer0 keeps millis(), Timer1 drives the motor PWM on 9/10.
+//   - ultrasonicMsTick() and inputsMsTick() every millisecond (sensors.cpp)
+//   - linkTxBitTick() once per bit time on the UNO, where the ESP32 link
+//     is bit-banged from this interrupt instead of SoftwareSerial's
+//     blocking write (serial_events.cpp)
+//   - encoderTick() once per bit time on the UNO, sampling the wheel
+//     encoders since SoftwareSerial owns every pin-change vector (motors.cpp)
+#if defined(__AVR__) && defined(TCCR2A)
+    #define HAVE_TICK_TIMER
+    #ifdef USE_SOFTWARE_SERIAL
+        #define TICK_HZ  SERIAL_BAUD_RATE
+    #else
+        #define TICK_HZ  1000
+    #endif
+
+    void startTickTimer();   // idempotent
+
+    void ultrasonicMsTick();
+    void inputsMsTick();
+    #ifdef USE_SOFTWARE_SERIAL
+    void linkTxBitTick();
+    #endif
+    #if defined(USE_SOFTWARE_SERIAL) && defined(WHEEL_ENCODERS)
+    #define ENCODERS_FROM_TICK
+    void encoderTick();
+    #endif
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+#include "wheel_control.h"
+
+#define DUTY_MAX_Q8  (255L << 8)
+
+void WheelController::setTarget(int16_t tps) {
+    if (tps == 0 || (tps < 0) != (target_ < 0)) integralQ8_ = 0;
+    if (tps == 0) duty_ = 0;
+    target_ = tps;
+    sinceTargetMs_ = 0;
+    slowMs_ = 0;
+    stalled_ = false;
+}
+
+int16_t WheelController::update(int16_t counts, uint16_t dtMs) {
+    if (dtMs == 0) return duty_;
+    if (dtMs > WHEEL_LATE_MS) {
+        // Counts averaged over the whole hold-up say little about the speed
+        // now, and would put one huge step into the integral. Keep the duty,
+        // start the estimate over next period.
+        restart_ = true;
+        return duty_;
+    }
+
+    int32_t instant = ((int32_t)counts * 1000 / dtMs) << 8;
+    if (restart_) speedQ8_ = instant;
+    else speedQ8_ += (instant - speedQ8_) >> WHEEL_SPEED_SHIFT;
+    restart_ = false;
+
+    if (target_ == 0) {
+        duty_ = 0;
+        return 0;
+    }
+
+    // Feedforward gets close on a fresh battery; PI makes up the rest as it sags
+    int32_t mag = target_ < 0 ? -target_ : target_;
+    int32_t ffQ8 = ((int32_t)WHEEL_MIN_DUTY << 8) + mag * WHEEL_FF_Q8;
+    if (target_ < 0) ffQ8 = -ffQ8;
+    int32_t err = target_ - speedTps();
+    int32_t outQ8 = ffQ8 + err * WHEEL_KP_Q8 + integralQ8_;
+
+    // Anti-windup: stop integrating further into saturation
+    int32_t di = err * WHEEL_KI_Q8 * (int32_t)dtMs / 1000;
+    if (!(outQ8 >= DUTY_MAX_Q8 && di > 0) && !(outQ8 <= -DUTY_MAX_Q8 && di < 0)) {
+        integralQ8_ += di;
+        if (integralQ8_ > DUTY_MAX_Q8) integralQ8_ = DUTY_MAX_Q8;
+        if (integralQ8_ < -DUTY_MAX_Q8) integralQ8_ = -DUTY_MAX_Q8;
+        outQ8 = ffQ8 + err * WHEEL_KP_Q8 + integralQ8_;
+    }
+
+    int32_t d = outQ8 >> 8;
+    if (d > 255) d = 255;
+    if (d < -255) d = -255;
+    // Never drive against the commanded direction, just ease off
+    if ((target_ > 0 && d < 0) || (target_ < 0 && d > 0)) d = 0;
+    duty_ = (int16_t)d;
+
+    // Stall: pushing but the wheel isn't following
+    if (sinceTargetMs_ < WHEEL_STALL_GRACE_MS) {
+        sinceTargetMs_ += dtMs;
+    } else {
+        int32_t along = target_ > 0 ? speedTps() : -speedTps();
+        if (along < (mag >> WHEEL_STALL_SHIFT)) {
+            if (slowMs_ < WHEEL_STALL_MS) slowMs_ += dtMs;
+            if (slowMs_ >= WHEEL_STALL_MS) stalled_ = true;
+        } else {
+            slowMs_ = 0;
+        }
+    }
+    return duty_;
+}
@@ -0,0 +1,60 @@
+#ifndef WHEEL_CONTROL_H
+#define WHEEL_CONTROL_H
+
+#include <stdint.h>
+
+// Per-wheel closed loop, integer only:
+//   encoder counts -> speed (ticks/s) -> feedforward + PI -> PWM duty
+//   commanded vs measured speed -> stall flag (feeds checkStuck())
+// No Arduino dependencies, so host/motor_sim.cpp tunes exactly this code
+// against a motor model.
+
+// Tuned in host/motor_sim.cpp for ~3000 ticks/s at full duty on a fresh pack
+#define WHEEL_MIN_DUTY      60     // below this the motors don't turn at all
+#define WHEEL_FF_Q8         17     // feedforward, duty per tick/s above the dead band (x256)
+#define WHEEL_KP_Q8         20     // duty per tick/s of error (x256)
+#define WHEEL_KI_Q8         300    // duty per tick/s of error per second (x256)
+#define WHEEL_SPEED_SHIFT   0      // speed EMA; 0 = raw, raise it for coarse (<500 ticks/rev) encoders
+#define WHEEL_LATE_MS       200    // a period longer than this (loop held up) restarts the speed estimate
+
+// Stalled: less than 1/4 of the commanded speed for WHEEL_STALL_MS, once the
+// wheel has had WHEEL_STALL_GRACE_MS to spin up
+#define WHEEL_STALL_SHIFT     2
+#define WHEEL_STALL_GRACE_MS  400
+#define WHEEL_STALL_MS        500
+
+// x4 quadrature decode: (previous AB << 2 | current AB) -> -1, 0, +1.
+// A leading B counts up. Impossible jumps (both lines changed) count 0.
+static const int8_t QUAD_STEP[16] = { 0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0 };
+
+class WheelController {
+public:
+    WheelController() : target_(0), speedQ8_(0), integralQ8_(0), restart_(false) { setTarget(0); }
+
+    // Signed ticks per second; 0 = coast. Clears the stall flag, and the
+    // integral on a stop or a change of direction.
+    void setTarget(int16_t tps);
+    int16_t target() const { return target_; }
+
+    // One control period: encoder counts since the last call and how long
+    // that was. Returns the duty to apply, -255..255 (sign = direction).
+    // A period over WHEEL_LATE_MS is skipped (duty held) and the next one
+    // measures the speed afresh.
+    int16_t update(int16_t counts, uint16_t dtMs);
+
+    int16_t speedTps() const { return (int16_t)(speedQ8_ >> 8); }
+    int16_t duty() const { return duty_; }
+    bool stalled() const { return stalled_; }
+
+private:
+    int16_t target_;
+    int16_t duty_;
+    int32_t speedQ8_;        // ticks/s, 24.8 fixed point
+    int32_t integralQ8_;     // duty, 24.8 fixed point
+    uint16_t sinceTargetMs_;
+    uint16_t slowMs_;        // time spent below the stall threshold
+    bool stalled_;
+    bool restart_;           // next period replaces the speed estimate
+};
+
+#endif
@@ -0,0 +1,78 @@
+// Replays a recorded ultrasonic trace through galileo_nav's RangeFilter and
+// reports where it would have stopped the rover, next to what the old
+// single-sample check (raw < COLLISION_DIST_CM) would have done.
+//
+//   g++ -O2 -I ../galileo_nav filter_replay.cpp ../galileo_nav/range_filter.cpp -o filter_replay
+//   ./filter_replay trace.txt [-v] [ttc_ms] [min_closing_mm_s]
+//
+// Recording: uncomment RANGE_TRACE in config.h and save the USB serial
+// output. Lines look like "R,<ms>,<echo us>"; anything else is ignored, so
+// the raw monitor log can be fed in as-is.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "range_filter.h"
+
+// Defaults mirror config.h
+#define COLLISION_DIST_CM           15
+#define COLLISION_TTC_MS            600
+#define COLLISION_MIN_CLOSING_MM_S  60
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <trace> [-v] [ttc_ms] [min_closing_mm_s]\n", argv[0]);
+        return 2;
+    }
+    FILE* f = fopen(argv[1], "r");
+    if (!f) { perror(argv[1]); return 2; }
+
+    bool verbose = false;
+    int ttcMs = COLLISION_TTC_MS;
+    int minClosing = COLLISION_MIN_CLOSING_MM_S;
+    int positional = 0;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) verbose = true;
+        else if (positional++ == 0) ttcMs = atoi(argv[i]);
+        else minClosing = atoi(argv[i]);
+    }
+
+    RangeFilter range;
+    char line[128];
+    unsigned pings = 0;
+    long firstRaw = -1, firstFiltered = -1;
+    bool rawActive = false, filteredActive = false;
+    unsigned rawEdges = 0, filteredEdges = 0;
+
+    if (verbose) printf("ms,raw_mm,filtered_mm,closing_mm_s,ttc_ms,raw_hit,filtered_hit\n");
+    while (fgets(line, sizeof(line), f)) {
+        unsigned long ms, us;
+        if (sscanf(line, "R,%lu,%lu", &ms, &us) != 2) continue;
+        pings++;
+        range.add((uint16_t)us, (uint32_t)ms);
+
+        uint16_t rawMm = RangeFilter::echoToMm((uint16_t)us);
+        bool rawHit = us != 0 && rawMm < COLLISION_DIST_CM * 10;
+        bool hit = range.collisionAhead(COLLISION_DIST_CM * 10, ttcMs, minClosing);
+
+        if (rawHit && firstRaw < 0) firstRaw = ms;
+        if (hit && firstFiltered < 0) firstFiltered = ms;
+        // Count stops (rising edges), not pings spent in the zone
+        if (rawHit && !rawActive) rawEdges++;
+        if (hit && !filteredActive) filteredEdges++;
+        rawActive = rawHit;
+        filteredActive = hit;
+
+        if (verbose) {
+            uint16_t ttc = range.timeToCollisionMs();
+            printf("%lu,%u,%u,%d,%d,%d,%d\n", ms, rawMm, range.distanceMm(), range.closingMmPerS(),
+                   ttc == RANGE_NO_TTC ? -1 : ttc, rawHit, hit);
+        }
+    }
+    fclose(f);
+
+    printf("pings: %u\n", pings);
+    printf("raw check:      %u stops, first at %ld ms\n", rawEdges, firstRaw);
+    printf("filtered + TTC: %u stops, first at %ld ms\n", filteredEdges, firstFiltered);
+    return 0;
+}
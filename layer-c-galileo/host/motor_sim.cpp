@@ -0,0 +1,155 @@
+// Runs galileo_nav's WheelController against a simple DC motor model, for
+// tuning the gains in wheel_control.h without a rover on the bench.
+//
+//   g++ -O2 -I ../galileo_nav motor_sim.cpp ../galileo_nav/wheel_control.cpp -o motor_sim
+//   ./motor_sim [-v] [battery_end_v]
+//
+// Both wheels cruise at WHEEL_CRUISE_TPS for 20 s while the pack sags from
+// 8.2 V to battery_end_v (default 6.4), with a patch of carpet at 6-8 s and
+// the left wheel jammed from 16 s. The same run is repeated open loop at the
+// old fixed duty of 200 for comparison. -v prints a CSV of the closed-loop run.
+//
+// Model per wheel: speed settles towards kv * (V * duty / 255 - dead band
+// - load) with time constant TAU_MS. Encoder edges come out of the
+// integrated position as AB Gray code, sampled every 0.1 ms (about the
+// UNO's Timer2 tick) and counted through QUAD_STEP like the firmware does.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "wheel_control.h"
+
+// Mirror config.h
+#define WHEEL_CRUISE_TPS  2000
+#define MOTOR_PERIOD_MS   20
+#define OPEN_LOOP_DUTY    200
+
+#define SIM_STEP_US    100
+#define RUN_MS         20000
+#define TAU_MS         80.0
+#define DEAD_BAND_V    1.9      // ~ duty 60 on a full pack
+#define CARPET_V       0.8
+#define CARPET_FROM_MS 6000
+#define CARPET_TO_MS   8000
+#define JAM_FROM_MS    16000
+
+struct Motor {
+    double kv;          // ticks/s per volt above the dead band
+    double speed;       // ticks/s
+    double pos;         // ticks
+    uint8_t ab;         // last sampled encoder lines
+    int16_t counts;     // decoded since the last control period
+};
+
+static const uint8_t GRAY[4] = { 0, 2, 3, 1 };  // AB sequence, A leading
+
+static double battery(double tMs, double vEnd) {
+    return 8.2 + (vEnd - 8.2) * tMs / RUN_MS;
+}
+
+static void stepMotor(Motor& m, int16_t duty, double volts, double loadV, bool jammed) {
+    double v = volts * (duty < 0 ? -duty : duty) / 255.0 - DEAD_BAND_V - loadV;
+    double target = v > 0 ? m.kv * v : 0;
+    if (duty < 0) target = -target;
+    if (jammed) {
+        m.speed = 0;
+    } else {
+        m.speed += (target - m.speed) * (SIM_STEP_US / 1000.0) / TAU_MS;
+    }
+    m.pos += m.speed * SIM_STEP_US / 1e6;
+    uint8_t ab = GRAY[(long)floor(m.pos) & 3];
+    m.counts += QUAD_STEP[(m.ab << 2) | ab];
+    m.ab = ab;
+}
+
+struct Result {
+    double meanErr[2];      // mean |speed - target| after spin-up, before the jam
+    double drift;           // left minus right ticks at the jam (heading error)
+    double speedEarly, speedLate;  // left wheel mean speed over 1-3 s and 12-15 s
+    long stallAtMs[2];      // first stall flag, -1 if never
+    long falseStalls;       // stall flags before the jam
+};
+
+static Result run(bool closedLoop, double vEnd, bool verbose) {
+    // Right motor ~8% weaker, as a cheap pair usually is
+    Motor motors[2] = { { 530, 0, 0, 0, 0 }, { 490, 0, 0, 0, 0 } };
+    WheelController wheels[2];
+    int16_t duty[2] = { 0, 0 };
+    Result r;
+    memset(&r, 0, sizeof(r));
+    r.stallAtMs[0] = r.stallAtMs[1] = -1;
+    double errSum[2] = { 0, 0 };
+    long errN = 0;
+    double early = 0, late = 0;
+    long earlyN = 0, lateN = 0;
+
+    for (int w = 0; w < 2; w++) wheels[w].setTarget(WHEEL_CRUISE_TPS);
+    if (verbose) printf("ms,volts,target,left_tps,right_tps,left_duty,right_duty,left_stall\n");
+
+    for (long us = 0; us < RUN_MS * 1000L; us += SIM_STEP_US) {
+        double tMs = us / 1000.0;
+        double volts = battery(tMs, vEnd);
+        double loadV = tMs >= CARPET_FROM_MS && tMs < CARPET_TO_MS ? CARPET_V : 0;
+        for (int w = 0; w < 2; w++) {
+            stepMotor(motors[w], duty[w], volts, loadV, w == 0 && tMs >= JAM_FROM_MS);
+        }
+
+        if (us % (MOTOR_PERIOD_MS * 1000L) != 0) continue;
+        long ms = us / 1000;
+        for (int w = 0; w < 2; w++) {
+            int16_t d = wheels[w].update(motors[w].counts, MOTOR_PERIOD_MS);
+            motors[w].counts = 0;
+            duty[w] = closedLoop ? d : OPEN_LOOP_DUTY;
+            if (wheels[w].stalled() && r.stallAtMs[w] < 0) {
+                r.stallAtMs[w] = ms;
+                if (ms < JAM_FROM_MS) r.falseStalls++;
+            }
+        }
+        if (ms >= 1000 && ms < JAM_FROM_MS) {
+            for (int w = 0; w < 2; w++) errSum[w] += fabs(motors[w].speed - WHEEL_CRUISE_TPS);
+            errN++;
+        }
+        if (ms >= 1000 && ms < 3000) { early += motors[0].speed; earlyN++; }
+        if (ms >= 12000 && ms < 15000) { late += motors[0].speed; lateN++; }
+        if (ms == JAM_FROM_MS) r.drift = motors[0].pos - motors[1].pos;
+        if (verbose) {
+            printf("%ld,%.2f,%d,%.0f,%.0f,%d,%d,%d\n", ms, volts, WHEEL_CRUISE_TPS, motors[0].speed,
+                   motors[1].speed, duty[0], duty[1], wheels[0].stalled());
+        }
+    }
+    for (int w = 0; w < 2; w++) r.meanErr[w] = errSum[w] / errN;
+    r.speedEarly = early / earlyN;
+    r.speedLate = late / lateN;
+    return r;
+}
+
+static void report(const char* name, const Result& r) {
+    printf("%s:\n", name);
+    printf("  mean speed error   L %.0f  R %.0f ticks/s\n", r.meanErr[0], r.meanErr[1]);
+    printf("  left speed         %.0f at 1-3 s, %.0f at 12-15 s\n", r.speedEarly, r.speedLate);
+    printf("  L-R drift at jam   %.0f ticks\n", r.drift);
+    if (r.stallAtMs[0] >= 0) {
+        printf("  stall flagged      %ld ms after the jam\n", r.stallAtMs[0] - JAM_FROM_MS);
+    } else {
+        printf("  stall flagged      never\n");
+    }
+    printf("  false stalls       %ld\n", r.falseStalls);
+}
+
+int main(int argc, char** argv) {
+    bool verbose = false;
+    double vEnd = 6.4;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) verbose = true;
+        else vEnd = atof(argv[i]);
+    }
+
+    Result closed = run(true, vEnd, verbose);
+    if (verbose) return 0;
+    Result open = run(false, vEnd, false);
+    printf("target %d ticks/s, battery 8.2 -> %.1f V\n", WHEEL_CRUISE_TPS, vEnd);
+    report("closed loop (PI)", closed);
+    report("open loop (duty 200)", open);
+    return 0;
+}
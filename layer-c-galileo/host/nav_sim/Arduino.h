@@ -0,0 +1,100 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// The slice of the Arduino API galileo_nav uses, on a virtual clock, for
+// host/nav_sim. The sketch builds as the generic (Galileo) config: link on
+// Serial1, CHANGE interrupts on the echo, bumper and encoder pins, ultrasonic
+// trigger polled from checkCollision(). The simulator side is in sim_hal.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+#define CHANGE        1
+#define RISING        2
+#define FALLING       3
+
+#define A0  14
+#define A1  15
+#define A2  16
+#define A3  17
+#define A4  18
+#define A5  19
+#define NUM_DIGITAL_PINS  20
+
+// Every pin has an interrupt, like the Galileo
+#define NOT_AN_INTERRUPT  -1
+#define digitalPinToInterrupt(p)  (p)
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int duty);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Handlers only ever run between loop() passes (sim_hal.h), so there is
+// nothing for these to mask
+void attachInterrupt(int irq, void (*fn)(), int mode);
+void detachInterrupt(int irq);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t b) = 0;
+    size_t write(const uint8_t* p, size_t n) {
+        for (size_t i = 0; i < n; i++) write(p[i]);
+        return n;
+    }
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printFmt("%d", v); }
+    size_t print(unsigned int v) { return printFmt("%u", v); }
+    size_t print(long v) { return printFmt("%ld", v); }
+    size_t print(unsigned long v) { return printFmt("%lu", v); }
+    size_t print(double v) { return printFmt("%.2f", v); }
+    template<typename T> size_t println(T v) { return print(v) + println(); }
+    size_t println() { return print("\r\n"); }
+
+private:
+    size_t printFmt(const char* fmt, ...);
+};
+
+class HardwareSerial : public Print {
+public:
+    explicit HardwareSerial(uint8_t port) : port_(port) {}
+    void begin(unsigned long baud);
+    int available();
+    int read();
+    int availableForWrite();
+    size_t write(uint8_t b);
+    using Print::write;
+    operator bool() const { return true; }
+
+private:
+    uint8_t port_;
+};
+
+extern HardwareSerial Serial;    // USB debug
+extern HardwareSerial Serial1;   // ESP32 link
+
+#endif
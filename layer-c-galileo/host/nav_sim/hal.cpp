@@ -0,0 +1,165 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include "sim_hal.h"
+
+uint64_t simNowUs = 0;
+void (*simOnDigitalWrite)(uint8_t pin, bool high) = NULL;
+bool simDebugEcho = false;
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+
+// =============================================================
+// PINS
+// =============================================================
+
+struct SimPin {
+    uint8_t mode;
+    bool input;         // level driven by the world
+    uint8_t duty;       // level driven by the firmware, 0-255
+    void (*isr)();
+    uint8_t isrMode;
+};
+
+static SimPin pins[SIM_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= SIM_PINS) return;
+    pins[pin].mode = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    if (pin >= SIM_PINS) return;
+    pins[pin].duty = level ? 255 : 0;
+    if (simOnDigitalWrite) simOnDigitalWrite(pin, level);
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= SIM_PINS) return LOW;
+    return pins[pin].input ? HIGH : LOW;
+}
+
+void analogWrite(uint8_t pin, int duty) {
+    if (pin >= SIM_PINS) return;
+    pins[pin].duty = duty < 0 ? 0 : duty > 255 ? 255 : duty;
+}
+
+void attachInterrupt(int irq, void (*fn)(), int mode) {
+    if (irq < 0 || irq >= SIM_PINS) return;
+    pins[irq].isr = fn;
+    pins[irq].isrMode = mode;
+}
+
+void detachInterrupt(int irq) {
+    if (irq < 0 || irq >= SIM_PINS) return;
+    pins[irq].isr = NULL;
+}
+
+void simSetInput(uint8_t pin, bool high) {
+    SimPin& p = pins[pin];
+    if (p.input == high) return;
+    p.input = high;
+    if (!p.isr) return;
+    if (p.isrMode == CHANGE || (p.isrMode == RISING && high) || (p.isrMode == FALLING && !high)) p.isr();
+}
+
+uint8_t simOutputDuty(uint8_t pin) {
+    return pin < SIM_PINS ? pins[pin].duty : 0;
+}
+
+// =============================================================
+// CLOCK
+// =============================================================
+
+unsigned long millis() { return (unsigned long)(simNowUs / 1000); }
+unsigned long micros() { return (unsigned long)simNowUs; }
+void delay(unsigned long ms) { simNowUs += ms * 1000ULL; }
+void delayMicroseconds(unsigned int us) { simNowUs += us; }
+
+// Firmware's own random(), separate from the world's so a room is the same
+// whatever the firmware draws
+static uint32_t rngState = 1;
+
+static uint32_t nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+void randomSeed(unsigned long seed) { rngState = seed ? (uint32_t)seed : 1; }
+long random(long howbig) { return howbig > 0 ? (long)(nextRandom() % (uint32_t)howbig) : 0; }
+long random(long howsmall, long howbig) { return howbig > howsmall ? howsmall + random(howbig - howsmall) : howsmall; }
+
+// =============================================================
+// SERIAL
+// =============================================================
+// Serial1's TX side is a FIFO clocked out at SIM_LINK_BAUD (10 bits a byte),
+// so the firmware sees the same back-pressure as on a real UART.
+
+#define BYTE_US  (10000000ULL / SIM_LINK_BAUD)
+
+struct Fifo {
+    uint8_t data[SIM_UART_FIFO];
+    uint8_t head, count;
+
+    bool push(uint8_t b) {
+        if (count >= SIM_UART_FIFO) return false;
+        data[(head + count++) % SIM_UART_FIFO] = b;
+        return true;
+    }
+    int pop() {
+        if (count == 0) return -1;
+        uint8_t b = data[head];
+        head = (head + 1) % SIM_UART_FIFO;
+        count--;
+        return b;
+    }
+};
+
+static Fifo linkTx, linkRx;
+static uint64_t linkTxDoneUs = 0;   // when the byte at the head is fully out
+
+size_t Print::printFmt(const char* fmt, ...) {
+    char buf[32];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
+void HardwareSerial::begin(unsigned long) {}
+
+int HardwareSerial::available() {
+    return port_ == 1 ? linkRx.count : 0;
+}
+
+int HardwareSerial::read() {
+    return port_ == 1 ? linkRx.pop() : -1;
+}
+
+int HardwareSerial::availableForWrite() {
+    return port_ == 1 ? SIM_UART_FIFO - linkTx.count : SIM_UART_FIFO;
+}
+
+size_t HardwareSerial::write(uint8_t b) {
+    if (port_ != 1) {
+        if (simDebugEcho) putchar(b);
+        return 1;
+    }
+    if (linkTx.count == 0) linkTxDoneUs = simNowUs + BYTE_US;
+    return linkTx.push(b) ? 1 : 0;
+}
+
+int simLinkTx() {
+    if (linkTx.count == 0 || simNowUs < linkTxDoneUs) return -1;
+    int b = linkTx.pop();
+    linkTxDoneUs += BYTE_US;
+    return b;
+}
+
+void simLinkRx(const uint8_t* p, uint8_t n) {
+    while (n--) linkRx.push(*p++);
+}
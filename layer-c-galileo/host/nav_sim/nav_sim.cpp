@@ -0,0 +1,218 @@
+// Runs galileo_nav itself (the sketch and its .cpp files, unmodified) in
+// simulated rooms, much faster than real time, and scores how it gets
+// around. For comparing navigation changes without a rover on the floor.
+//
+//   cd layer-c-galileo/host
+//   g++ -O2 -I nav_sim -I ../galileo_nav -x c++ ../galileo_nav/galileo_nav.ino -x none nav_sim/*.cpp ../galileo_nav/*.cpp -o nav_sim/nav_sim
+//   ./nav_sim/nav_sim [-n runs] [-t seconds] [-s seed] [-j jobs] [-v] [-d]
+//
+// Each run is a fresh process (fork), so every static in the firmware starts
+// from zero, and runs go -j at a time (default: one per CPU). Room i uses
+// seed + i; "-n 1 -s <seed> -v" replays one run with its event stream
+// (contacts in brackets), -d adds the firmware's USB debug output. The sim
+// stands in for the ESP32 too: it decodes the link and ACKs every event.
+//
+// Reported per run and summed up:
+//   contacts   body touched a wall or furniture (hard: faster than 10 cm/s)
+//   COLLISION / STUCK   events the firmware sent
+//   trapped    no 25 cm of progress for 60 s
+//   coverage   share of the reachable floor the body swept
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <vector>
+#include <algorithm>
+#include <Arduino.h>
+#include "sim_hal.h"
+#include "world.h"
+#include "events.h"
+#include "link_protocol.h"
+
+void setup();
+void loop();
+
+struct RunResult {
+    uint32_t seed;
+    WorldStats world;
+    uint16_t events[NAV_EVENT_COUNT];
+    uint16_t telemetry;
+};
+
+static RunResult runOne(uint32_t seed, uint32_t simMs, bool verbose) {
+    RunResult r;
+    memset(&r, 0, sizeof(r));
+    r.seed = seed;
+    worldGenerate(seed);
+    randomSeed(seed);
+    setup();
+
+    LinkParser esp;
+    int lastSeq = -1;
+    uint64_t endUs = simMs * 1000ULL;
+    while (simNowUs < endUs) {
+        worldStep();
+        int b;
+        while ((b = simLinkTx()) >= 0) {
+            esp.push((uint8_t)b);
+            LinkFrame f;
+            while (esp.next(f)) {
+                if (f.type == LINK_TELEMETRY) {
+                    r.telemetry++;
+                    continue;
+                }
+                if (f.type != LINK_EVENT || f.len < 1) continue;
+                uint8_t ack[LINK_FRAME_MAX];
+                simLinkRx(ack, linkEncode(ack, LINK_ACK, f.seq, NULL, 0));
+                if (f.seq == lastSeq) continue;   // a resend
+                lastSeq = f.seq;
+                NavEvent ev = (NavEvent)f.payload[0];
+                if (ev < NAV_EVENT_COUNT) r.events[ev]++;
+                if (verbose) {
+                    float x, y, h;
+                    worldPose(x, y, h);
+                    printf("%9.3f  %-14s  x %4.0f  y %4.0f  heading %4.0f\n", simNowUs / 1e6,
+                           navEventName(ev), x, y, h * 180 / 3.14159265);
+                }
+            }
+        }
+        if (verbose) {
+            WorldStats w = worldStats();
+            if (w.contacts != r.world.contacts) {
+                float x, y, h;
+                worldPose(x, y, h);
+                printf("%9.3f  %-14s  x %4.0f  y %4.0f  heading %4.0f\n", simNowUs / 1e6,
+                       w.hardContacts != r.world.hardContacts ? "(hard contact)" : "(contact)", x, y, h * 180 / 3.14159265);
+                r.world = w;
+            }
+        }
+        loop();
+    }
+    r.world = worldStats();
+    return r;
+}
+
+static void printRun(const RunResult& r) {
+    printf("seed %-10u  %5.1f m2  contacts %3u (hard %3u)  COLLISION %4u  STUCK %3u  %s coverage %5.1f%%\n",
+           r.seed, r.world.roomM2, r.world.contacts, r.world.hardContacts, r.events[NAV_COLLISION],
+           r.events[NAV_STUCK], r.world.trapped ? "TRAPPED" : "       ", r.world.coverage * 100);
+}
+
+static double percentile(std::vector<double> v, double p) {
+    std::sort(v.begin(), v.end());
+    return v[(size_t)(p * (v.size() - 1) + 0.5)];
+}
+
+static double wallSeconds() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int runs = 100;
+    uint32_t simS = 300;
+    uint32_t seed = 1;
+    int jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:s:j:vd")) != -1) {
+        switch (opt) {
+            case 'n': runs = atoi(optarg); break;
+            case 't': simS = atoi(optarg); break;
+            case 's': seed = strtoul(optarg, NULL, 0); break;
+            case 'j': jobs = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            case 'd': simDebugEcho = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-n runs] [-t seconds] [-s seed] [-j jobs] [-v] [-d]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (runs < 1) runs = 1;
+    if (verbose || simDebugEcho) jobs = 1;   // keep each run's output together
+    if (jobs < 1) jobs = 1;
+
+    double start = wallSeconds();
+    std::vector<RunResult> results;
+    std::vector<pid_t> pids(jobs, 0);
+    std::vector<int> fds(jobs, -1);
+    int next = 0, active = 0;
+    fflush(stdout);
+
+    while (next < runs || active > 0) {
+        // Fill free slots, then collect whichever run finishes first
+        for (int s = 0; s < jobs && next < runs; s++) {
+            if (pids[s]) continue;
+            int p[2];
+            if (pipe(p) != 0) { perror("pipe"); return 1; }
+            pid_t pid = fork();
+            if (pid < 0) { perror("fork"); return 1; }
+            if (pid == 0) {
+                close(p[0]);
+                RunResult r = runOne(seed + next, simS * 1000, verbose);
+                fflush(stdout);
+                ssize_t n = write(p[1], &r, sizeof(r));
+                _exit(n == sizeof(r) ? 0 : 1);
+            }
+            close(p[1]);
+            pids[s] = pid;
+            fds[s] = p[0];
+            next++;
+            active++;
+        }
+        int status;
+        pid_t done = wait(&status);
+        if (done < 0) break;
+        for (int s = 0; s < jobs; s++) {
+            if (pids[s] != done) continue;
+            RunResult r;
+            if (read(fds[s], &r, sizeof(r)) == sizeof(r)) {
+                results.push_back(r);
+                if (verbose || runs == 1) printRun(r);
+            } else {
+                fprintf(stderr, "run %d died (status %d)\n", s, status);
+            }
+            close(fds[s]);
+            pids[s] = 0;
+            active--;
+        }
+    }
+    double wall = wallSeconds() - start;
+    if (results.empty()) return 1;
+
+    size_t n = results.size();
+    double contacts = 0, hard = 0, collisions = 0, stuck = 0, distance = 0;
+    size_t anyContact = 0, anyStuck = 0, trapped = 0;
+    std::vector<double> coverage;
+    for (size_t i = 0; i < n; i++) {
+        const RunResult& r = results[i];
+        contacts += r.world.contacts;
+        hard += r.world.hardContacts;
+        collisions += r.events[NAV_COLLISION];
+        stuck += r.events[NAV_STUCK];
+        distance += r.world.distanceCm / 100;
+        if (r.world.contacts) anyContact++;
+        if (r.events[NAV_STUCK]) anyStuck++;
+        if (r.world.trapped) trapped++;
+        coverage.push_back(r.world.coverage * 100);
+    }
+    double meanCover = 0;
+    for (size_t i = 0; i < n; i++) meanCover += coverage[i];
+
+    printf("%zu runs x %u s, seeds %u..%u\n", n, simS, seed, seed + runs - 1);
+    printf("  simulated %.0f s in %.1f s wall (%.0fx real time, %d jobs)\n", (double)n * simS, wall,
+           n * simS / wall, jobs);
+    printf("  contacts/run   %6.2f  (hard %.2f)   runs with any %5.1f%%\n", contacts / n, hard / n,
+           100.0 * anyContact / n);
+    printf("  COLLISION/run  %6.2f\n", collisions / n);
+    printf("  STUCK/run      %6.2f   stuck rate %5.1f%% of runs\n", stuck / n, 100.0 * anyStuck / n);
+    printf("  trapped        %5.1f%% of runs\n", 100.0 * trapped / n);
+    printf("  coverage       mean %5.1f%%  p10 %5.1f%%  median %5.1f%%  p90 %5.1f%%\n", meanCover / n,
+           percentile(coverage, 0.1), percentile(coverage, 0.5), percentile(coverage, 0.9));
+    printf("  distance/run   %6.1f m\n", distance / n);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+
+// Simulator side of the mocked Arduino HAL (Arduino.h next to this file):
+// the virtual clock, the pin levels the firmware sees, and the bytes on its
+// two serial ports. Nothing here runs on its own; nav_sim.cpp advances the
+// clock, the world model (world.cpp) drives the inputs, and loop() is called
+// in between.
+
+#define SIM_PINS        20
+#define SIM_LINK_BAUD   9600
+#define SIM_UART_FIFO   64     // bytes the mocked UART buffers for TX and RX
+
+extern uint64_t simNowUs;      // millis()/micros() read this; delay() adds to it
+
+// An input pin changes level. Runs its interrupt handler if the edge matches.
+void simSetInput(uint8_t pin, bool high);
+
+// What the firmware drives on an output: 0-255, digitalWrite() HIGH is 255
+uint8_t simOutputDuty(uint8_t pin);
+
+// Called after every digitalWrite() (the world watches the ultrasonic trigger)
+extern void (*simOnDigitalWrite)(uint8_t pin, bool high);
+
+// Serial1 (the ESP32 link). simLinkTx() returns the next byte the UART has
+// finished clocking out by simNowUs, -1 if none. simLinkRx() queues bytes for
+// the firmware to read.
+int simLinkTx();
+void simLinkRx(const uint8_t* p, uint8_t n);
+
+// Copy Serial (USB debug) to stdout; dropped otherwise
+extern bool simDebugEcho;
+
+#endif
@@ -0,0 +1,563 @@
+#include "world.h"
+#include "sim_hal.h"
+#include "config.h"
+#include <math.h>
+#include <string.h>
+
+#define HARD_CONTACT_CM_S   10.0
+#define TRAP_RADIUS_CM      25.0
+#define TRAP_MS             60000
+
+// Motor model, same as host/motor_sim.cpp (battery held steady here)
+#define BATTERY_V      7.6
+#define DEAD_BAND_V    1.9
+#define TAU_MS         80.0
+#define KV_NOMINAL     530.0     // ticks/s per volt above the dead band
+
+#define ROOM_MIN_CM    250.0
+#define ROOM_MAX_CM    600.0
+#define MAX_BOXES      24
+#define MAX_SEGS       (4 + 4 * MAX_BOXES)
+#define MAX_EDGES      48
+#define GRID_MAX       ((int)(ROOM_MAX_CM / COVER_CELL_CM) + 1)
+
+#define DEG            (M_PI / 180.0)
+
+struct Seg { double x0, y0, x1, y1; };
+struct Box { double x0, y0, x1, y1; };
+
+static Seg segs[MAX_SEGS];
+static int nSegs;
+static Box boxes[MAX_BOXES];
+static int nBoxes;
+static double roomW, roomH;
+
+static uint32_t rng;
+
+static double rnd() {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return (rng >> 8) / 16777216.0;
+}
+
+static double rndRange(double lo, double hi) { return lo + (hi - lo) * rnd(); }
+
+static double gauss() {
+    double u = rnd() + 1e-12, v = rnd();
+    return sqrt(-2.0 * log(u)) * cos(2 * M_PI * v);
+}
+
+// =============================================================
+// GEOMETRY
+// =============================================================
+
+static void addSeg(double x0, double y0, double x1, double y1) {
+    Seg& s = segs[nSegs++];
+    s.x0 = x0; s.y0 = y0; s.x1 = x1; s.y1 = y1;
+}
+
+static void addBox(double x0, double y0, double x1, double y1) {
+    if (nBoxes >= MAX_BOXES) return;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > roomW) x1 = roomW;
+    if (y1 > roomH) y1 = roomH;
+    Box& b = boxes[nBoxes++];
+    b.x0 = x0; b.y0 = y0; b.x1 = x1; b.y1 = y1;
+    addSeg(x0, y0, x1, y0);
+    addSeg(x1, y0, x1, y1);
+    addSeg(x1, y1, x0, y1);
+    addSeg(x0, y1, x0, y0);
+}
+
+static bool insideBox(double x, double y) {
+    for (int i = 0; i < nBoxes; i++) {
+        const Box& b = boxes[i];
+        if (x > b.x0 && x < b.x1 && y > b.y0 && y < b.y1) return true;
+    }
+    return false;
+}
+
+// Distance from (x, y) to the segment, and the nearest point on it
+static double segDist(const Seg& s, double x, double y, double& cx, double& cy) {
+    double ex = s.x1 - s.x0, ey = s.y1 - s.y0;
+    double len2 = ex * ex + ey * ey;
+    double t = len2 > 0 ? ((x - s.x0) * ex + (y - s.y0) * ey) / len2 : 0;
+    if (t < 0) t = 0;
+    if (t > 1) t = 1;
+    cx = s.x0 + t * ex;
+    cy = s.y0 + t * ey;
+    return hypot(x - cx, y - cy);
+}
+
+// Free space around a point, and where the nearest obstacle is
+static double clearance(double x, double y, double& cx, double& cy) {
+    double best = 1e9;
+    for (int i = 0; i < nSegs; i++) {
+        double px, py;
+        double d = segDist(segs[i], x, y, px, py);
+        if (d < best) {
+            best = d;
+            cx = px;
+            cy = py;
+        }
+    }
+    return best;
+}
+
+static double clearance(double x, double y) {
+    double cx, cy;
+    return clearance(x, y, cx, cy);
+}
+
+// Distance along a ray to the nearest segment, -1 if none; also how
+// squarely it hits (|cos| of the angle off the surface normal)
+static double raycast(double x, double y, double ux, double uy, double& squareness) {
+    double best = -1;
+    for (int i = 0; i < nSegs; i++) {
+        const Seg& s = segs[i];
+        double ex = s.x1 - s.x0, ey = s.y1 - s.y0;
+        double denom = ux * ey - uy * ex;
+        if (fabs(denom) < 1e-12) continue;
+        double wx = s.x0 - x, wy = s.y0 - y;
+        double t = (wx * ey - wy * ex) / denom;
+        double u = (wx * uy - wy * ux) / denom;
+        if (t <= 0 || u < 0 || u > 1) continue;
+        if (best < 0 || t < best) {
+            best = t;
+            squareness = fabs(ux * -ey + uy * ex) / hypot(ex, ey);
+        }
+    }
+    return best;
+}
+
+// =============================================================
+// ROVER STATE
+// =============================================================
+
+static const uint8_t GRAY[4] = { 0, 2, 3, 1 };  // AB sequence, A leading
+
+struct Wheel {
+    double kv;
+    double speed;       // ticks/s
+    double pos;         // ticks
+    uint8_t pinA, pinB, pinFwd, pinBck;
+};
+
+static Wheel wheels[2];
+static double px, py, heading;
+static uint64_t physUs;
+
+// Input edges waiting for their time, sorted
+struct Edge {
+    uint64_t us;
+    uint8_t pin;
+    bool high;
+};
+static Edge edges[MAX_EDGES];
+static int nEdges;
+
+static const uint8_t bumpPin[2] = { PIN_BUMP_LEFT, PIN_BUMP_RIGHT };
+static bool bumpPressed[2];
+
+// The firmware's ultrasonic array (config.h), each sensor on the rim at
+// its mounting angle
+struct Sonar {
+    uint8_t trig, echo;
+    double angle;
+    bool trigHigh;
+    uint64_t riseUs, fallUs;    // latest echo pulse
+};
+static Sonar sonars[] = {
+    { PIN_ULTRASONIC_TRIG, PIN_ULTRASONIC_ECHO, 0, false, 0, 0 },
+#ifdef PIN_SONAR_LEFT_TRIG
+    { PIN_SONAR_LEFT_TRIG, PIN_SONAR_LEFT_ECHO, SONAR_SIDE_DEG * DEG, false, 0, 0 },
+#endif
+#ifdef PIN_SONAR_RIGHT_TRIG
+    { PIN_SONAR_RIGHT_TRIG, PIN_SONAR_RIGHT_ECHO, -SONAR_SIDE_DEG * DEG, false, 0, 0 },
+#endif
+#ifdef PIN_SONAR_REAR_TRIG
+    { PIN_SONAR_REAR_TRIG, PIN_SONAR_REAR_ECHO, M_PI, false, 0, 0 },
+#endif
+};
+#define N_SONARS  ((int)(sizeof(sonars) / sizeof(sonars[0])))
+
+static WorldStats stats;
+static bool inContact;
+static double trapX, trapY;
+static uint64_t trapSinceUs;
+
+static uint8_t floorCell[GRID_MAX][GRID_MAX];   // 1 = body can reach, 2 = swept
+static int gridW, gridH;
+static int floorCells, sweptCells;
+static double stampX, stampY;
+
+static void scheduleEdge(uint64_t us, uint8_t pin, bool high) {
+    if (nEdges >= MAX_EDGES) return;
+    int i = nEdges++;
+    while (i > 0 && edges[i - 1].us > us) {
+        edges[i] = edges[i - 1];
+        i--;
+    }
+    edges[i].us = us;
+    edges[i].pin = pin;
+    edges[i].high = high;
+}
+
+static void moveEdge(uint8_t pin, bool high, uint64_t us) {
+    for (int i = 0; i < nEdges; i++) {
+        if (edges[i].pin != pin || edges[i].high != high) continue;
+        memmove(&edges[i], &edges[i + 1], (nEdges - i - 1) * sizeof(Edge));
+        nEdges--;
+        scheduleEdge(us, pin, high);
+        return;
+    }
+}
+
+// Switch closes (active LOW) with a short bounce: make, break, make
+static void setBumper(int i, bool pressed) {
+    if (bumpPressed[i] == pressed) return;
+    bumpPressed[i] = pressed;
+    bool level = !pressed;
+    scheduleEdge(simNowUs, bumpPin[i], level);
+    scheduleEdge(simNowUs + 300, bumpPin[i], !level);
+    scheduleEdge(simNowUs + 700, bumpPin[i], level);
+}
+
+// Trigger pulse done: the echo line goes HIGH after the sensor's burst and
+// stays HIGH for the round trip (or 38 ms when nothing comes back). The
+// sensor takes the first return it hears, its own or not: one still
+// listening that faces the same way ends on this ping's echo if that's
+// back sooner (crosstalk).
+static void ping(Sonar& sn) {
+    double dir = heading + sn.angle;
+    double sx = px + (ROBOT_RADIUS_CM - 1) * cos(dir);
+    double sy = py + (ROBOT_RADIUS_CM - 1) * sin(dir);
+    double best = -1;
+    for (int i = 0; i < SONAR_RAYS; i++) {
+        double a = dir + (-SONAR_FAN_DEG + 2.0 * SONAR_FAN_DEG * i / (SONAR_RAYS - 1)) * DEG;
+        double square = 0;
+        double d = raycast(sx, sy, cos(a), sin(a), square);
+        if (d < 0 || d > SONAR_MAX_CM) continue;
+        if (square < cos(SONAR_MAX_INCIDENCE * DEG)) continue;  // glances off
+        if (best < 0 || d < best) best = d;
+    }
+    uint64_t rise = simNowUs + 460;
+    uint64_t widthUs = 38000;
+    bool heard = best >= 0 && rnd() * 100 >= SONAR_DROPOUT_PCT;
+    if (heard) {
+        double d = best * (1 + 0.01 * gauss()) + 0.3 * gauss();
+        if (d < 2) d = 2;
+        widthUs = (uint64_t)(d * 58.3);
+    }
+    sn.riseUs = rise;
+    sn.fallUs = rise + widthUs;
+    scheduleEdge(sn.riseUs, sn.echo, true);
+    scheduleEdge(sn.fallUs, sn.echo, false);
+    if (!heard) return;
+    for (int i = 0; i < N_SONARS; i++) {
+        Sonar& other = sonars[i];
+        if (&other == &sn || cos(other.angle - sn.angle) <= 0) continue;
+        if (other.riseUs < sn.fallUs && sn.fallUs < other.fallUs) {
+            other.fallUs = sn.fallUs;
+            moveEdge(other.echo, false, other.fallUs);
+        }
+    }
+}
+
+static void onDigitalWrite(uint8_t pin, bool high) {
+    for (int i = 0; i < N_SONARS; i++) {
+        Sonar& sn = sonars[i];
+        if (pin != sn.trig) continue;
+        if (high) {
+            sn.trigHigh = true;
+        } else if (sn.trigHigh) {
+            sn.trigHigh = false;
+            ping(sn);
+        }
+    }
+}
+
+static void setEncoderLines(const Wheel& w) {
+    uint8_t ab = GRAY[(long)floor(w.pos) & 3];
+    simSetInput(w.pinA, ab & 2);
+    simSetInput(w.pinB, ab & 1);
+}
+
+// =============================================================
+// COVERAGE
+// =============================================================
+// Floor = every cell the body can cover from the start: flood fill the
+// cells the centre fits in, then grow them by the body radius.
+
+static void stampBody(double x, double y, uint8_t from, uint8_t to) {
+    int r = (int)ceil(ROBOT_RADIUS_CM / COVER_CELL_CM);
+    int cx = (int)(x / COVER_CELL_CM), cy = (int)(y / COVER_CELL_CM);
+    for (int gy = cy - r; gy <= cy + r; gy++) {
+        for (int gx = cx - r; gx <= cx + r; gx++) {
+            if (gx < 0 || gy < 0 || gx >= gridW || gy >= gridH) continue;
+            double dx = (gx + 0.5) * COVER_CELL_CM - x, dy = (gy + 0.5) * COVER_CELL_CM - y;
+            if (dx * dx + dy * dy > ROBOT_RADIUS_CM * ROBOT_RADIUS_CM) continue;
+            if (floorCell[gy][gx] != from) continue;
+            floorCell[gy][gx] = to;
+            if (to == 1) floorCells++;
+            else sweptCells++;
+        }
+    }
+}
+
+static void buildFloor() {
+    static uint8_t fits[GRID_MAX][GRID_MAX];
+    static int16_t queue[GRID_MAX * GRID_MAX][2];
+    gridW = (int)ceil(roomW / COVER_CELL_CM);
+    gridH = (int)ceil(roomH / COVER_CELL_CM);
+    memset(fits, 0, sizeof(fits));
+    memset(floorCell, 0, sizeof(floorCell));
+    floorCells = sweptCells = 0;
+
+    int n = 0;
+    int sx = (int)(px / COVER_CELL_CM), sy = (int)(py / COVER_CELL_CM);
+    fits[sy][sx] = 1;
+    queue[n][0] = sx;
+    queue[n][1] = sy;
+    n++;
+    for (int q = 0; q < n; q++) {
+        int x = queue[q][0], y = queue[q][1];
+        stampBody((x + 0.5) * COVER_CELL_CM, (y + 0.5) * COVER_CELL_CM, 0, 1);
+        static const int8_t STEP[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+        for (int k = 0; k < 4; k++) {
+            int nx = x + STEP[k][0], ny = y + STEP[k][1];
+            if (nx < 0 || ny < 0 || nx >= gridW || ny >= gridH || fits[ny][nx]) continue;
+            double cx = (nx + 0.5) * COVER_CELL_CM, cy = (ny + 0.5) * COVER_CELL_CM;
+            if (insideBox(cx, cy) || clearance(cx, cy) < ROBOT_RADIUS_CM) continue;
+            fits[ny][nx] = 1;
+            queue[n][0] = nx;
+            queue[n][1] = ny;
+            n++;
+        }
+    }
+}
+
+// =============================================================
+// ROOM
+// =============================================================
+
+void worldGenerate(uint32_t seed) {
+    rng = seed * 2654435761u ^ 0x5bd1e995u;
+    if (!rng) rng = 1;
+    for (int i = 0; i < 8; i++) rnd();
+
+    nSegs = nBoxes = nEdges = 0;
+    roomW = rndRange(ROOM_MIN_CM, ROOM_MAX_CM);
+    roomH = rndRange(ROOM_MIN_CM, ROOM_MAX_CM);
+    addSeg(0, 0, roomW, 0);
+    addSeg(roomW, 0, roomW, roomH);
+    addSeg(roomW, roomH, 0, roomH);
+    addSeg(0, roomH, 0, 0);
+
+    // Furniture, about half of it against a wall
+    int pieces = (int)(rnd() * 6);
+    for (int i = 0; i < pieces; i++) {
+        double w = rndRange(25, 120), h = rndRange(25, 120);
+        double x = rndRange(0, roomW - w), y = rndRange(0, roomH - h);
+        if (rnd() < 0.5) {
+            switch ((int)(rnd() * 4)) {
+                case 0: x = 0; break;
+                case 1: x = roomW - w; break;
+                case 2: y = 0; break;
+                default: y = roomH - h; break;
+            }
+        }
+        addBox(x, y, x + w, y + h);
+    }
+    // Chairs: four thin legs, easy for the ultrasonic to miss
+    int chairs = (int)(rnd() * 3);
+    for (int i = 0; i < chairs; i++) {
+        double x = rndRange(20, roomW - 60), y = rndRange(20, roomH - 60);
+        for (int k = 0; k < 4; k++) {
+            double lx = x + (k & 1) * 38, ly = y + (k >> 1) * 38;
+            addBox(lx, ly, lx + 3, ly + 3);
+        }
+    }
+
+    // Somewhere with room to start
+    bool placed = false;
+    for (int tries = 0; tries < 2000 && !placed; tries++) {
+        px = rndRange(0, roomW);
+        py = rndRange(0, roomH);
+        placed = !insideBox(px, py) && clearance(px, py) >= ROBOT_RADIUS_CM + 15;
+    }
+    if (!placed) {
+        nSegs = 4;
+        nBoxes = 0;
+        px = roomW / 2;
+        py = roomH / 2;
+    }
+    heading = rndRange(-M_PI, M_PI);
+
+    static const uint8_t pins[2][4] = {
+        { PIN_ENC_LEFT_A, PIN_ENC_LEFT_B, PIN_MOTOR_LEFT_FWD, PIN_MOTOR_LEFT_BCK },
+        { PIN_ENC_RIGHT_A, PIN_ENC_RIGHT_B, PIN_MOTOR_RIGHT_FWD, PIN_MOTOR_RIGHT_BCK }
+    };
+    for (int w = 0; w < 2; w++) {
+        Wheel& wh = wheels[w];
+        wh.kv = KV_NOMINAL * rndRange(0.9, 1.0);   // never quite a matched pair
+        wh.speed = 0;
+        wh.pos = 0;
+        wh.pinA = pins[w][0];
+        wh.pinB = pins[w][1];
+        wh.pinFwd = pins[w][2];
+        wh.pinBck = pins[w][3];
+        setEncoderLines(wh);
+    }
+
+    // Idle levels before setup() reads them: switches open (pulled up)
+    simSetInput(PIN_BUMP_LEFT, true);
+    simSetInput(PIN_BUMP_RIGHT, true);
+    simSetInput(PIN_RESET_BUTTON, true);
+    for (int i = 0; i < N_SONARS; i++) {
+        simSetInput(sonars[i].echo, false);
+        sonars[i].trigHigh = false;
+        sonars[i].riseUs = sonars[i].fallUs = 0;
+    }
+    bumpPressed[0] = bumpPressed[1] = false;
+    simOnDigitalWrite = onDigitalWrite;
+
+    physUs = simNowUs;
+    memset(&stats, 0, sizeof(stats));
+    inContact = false;
+    trapX = px;
+    trapY = py;
+    trapSinceUs = simNowUs;
+
+    buildFloor();
+    stats.roomM2 = floorCells * COVER_CELL_CM * COVER_CELL_CM / 10000.0;
+    stampX = px;
+    stampY = py;
+    stampBody(px, py, 1, 2);
+}
+
+// =============================================================
+// PHYSICS
+// =============================================================
+
+static void stepWheel(Wheel& w, double dt) {
+    int duty = (int)simOutputDuty(w.pinFwd) - (int)simOutputDuty(w.pinBck);
+    double v = BATTERY_V * (duty < 0 ? -duty : duty) / 255.0 - DEAD_BAND_V;
+    double target = v > 0 ? w.kv * v : 0;
+    if (duty < 0) target = -target;
+    w.speed += (target - w.speed) * dt * 1000.0 / TAU_MS;
+}
+
+static void moveEncoder(Wheel& w, double dt) {
+    double to = w.pos + w.speed * dt;
+    // One quadrature step at a time, so the firmware sees every edge
+    while (floor(to) != floor(w.pos)) {
+        w.pos = to > w.pos ? floor(w.pos) + 1 : ceil(w.pos) - 1;
+        setEncoderLines(w);
+    }
+    w.pos = to;
+}
+
+static void senseContact() {
+    double c = clearance(px, py);
+    if (c > ROBOT_RADIUS_CM + 1.0) inContact = false;
+    bool left = false, right = false;
+    for (int i = 0; c <= ROBOT_RADIUS_CM + BUMPER_TRAVEL_CM && i < nSegs; i++) {
+        double sx, sy;
+        if (segDist(segs[i], px, py, sx, sy) > ROBOT_RADIUS_CM + BUMPER_TRAVEL_CM) continue;
+        double bearing = atan2(sy - py, sx - px) - heading;
+        while (bearing > M_PI) bearing -= 2 * M_PI;
+        while (bearing < -M_PI) bearing += 2 * M_PI;
+        if (fabs(bearing) > BUMPER_ARC_DEG * DEG) continue;   // behind the bumper
+        if (bearing >= -10 * DEG) left = true;
+        if (bearing <= 10 * DEG) right = true;
+    }
+    setBumper(0, left);
+    setBumper(1, right);
+}
+
+void worldStep() {
+    uint64_t end = physUs + WORLD_STEP_US;
+    while (nEdges > 0 && edges[0].us <= end) {
+        Edge e = edges[0];
+        nEdges--;
+        memmove(edges, edges + 1, nEdges * sizeof(Edge));
+        if (e.us > simNowUs) simNowUs = e.us;
+        simSetInput(e.pin, e.high);
+    }
+    physUs = end;
+    if (simNowUs < end) simNowUs = end;
+
+    double dt = WORLD_STEP_US / 1e6;
+    for (int w = 0; w < 2; w++) stepWheel(wheels[w], dt);
+
+    double vl = wheels[0].speed / TICKS_PER_CM, vr = wheels[1].speed / TICKS_PER_CM;
+    double v = (vl + vr) / 2;
+    heading += (vr - vl) / WHEEL_BASE_CM * dt;
+    if (heading > M_PI) heading -= 2 * M_PI;
+    if (heading < -M_PI) heading += 2 * M_PI;
+
+    // A round body can always turn on the spot; straight-line motion into
+    // something slides along it, and the wheels are held back to match
+    double dx = v * cos(heading) * dt, dy = v * sin(heading) * dt;
+    double want = hypot(dx, dy);
+    if (want > 0) {
+        double cx = px, cy = py;
+        if (clearance(px + dx, py + dy) < ROBOT_RADIUS_CM) {
+            clearance(px, py, cx, cy);
+            double nx = px - cx, ny = py - cy, nl = hypot(nx, ny);
+            nx /= nl;
+            ny /= nl;
+            double into = dx * nx + dy * ny;
+            double approach = 0;
+            if (into < 0) {
+                approach = -into / dt;
+                dx -= into * nx;
+                dy -= into * ny;
+            }
+            if (clearance(px + dx, py + dy) < ROBOT_RADIUS_CM) dx = dy = 0;   // in a corner
+            if (!inContact) {
+                inContact = true;
+                stats.contacts++;
+                if (approach > HARD_CONTACT_CM_S) stats.hardContacts++;
+            }
+            double frac = hypot(dx, dy) / want;
+            double common = (wheels[0].speed + wheels[1].speed) / 2 * frac;
+            double diff = (wheels[1].speed - wheels[0].speed) / 2;
+            wheels[0].speed = common - diff;
+            wheels[1].speed = common + diff;
+        }
+        px += dx;
+        py += dy;
+        stats.distanceCm += hypot(dx, dy);
+    }
+    for (int w = 0; w < 2; w++) moveEncoder(wheels[w], dt);
+    senseContact();
+
+    if (hypot(px - stampX, py - stampY) >= 1.0) {
+        stampX = px;
+        stampY = py;
+        stampBody(px, py, 1, 2);
+    }
+    if (hypot(px - trapX, py - trapY) > TRAP_RADIUS_CM) {
+        trapX = px;
+        trapY = py;
+        trapSinceUs = simNowUs;
+    } else if (simNowUs - trapSinceUs > TRAP_MS * 1000ULL) {
+        stats.trapped = true;
+    }
+}
+
+WorldStats worldStats() {
+    WorldStats s = stats;
+    s.coverage = floorCells ? (float)sweptCells / floorCells : 0;
+    return s;
+}
+
+void worldPose(float& x, float& y, float& h) {
+    x = px;
+    y = py;
+    h = heading;
+}
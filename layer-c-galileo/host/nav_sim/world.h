@@ -0,0 +1,54 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <stdint.h>
+
+// 2D room for host/nav_sim: walls and furniture as line segments, a round
+// differential-drive rover with the motor model from host/motor_sim.cpp,
+// and the rover's sensors wired to the firmware's pins (config.h):
+//   - ultrasonic, per sensor of the array: a trigger falling edge casts a
+//     fan of rays along its bearing; the nearest hit that would reflect back
+//     becomes an echo pulse, and can end a neighbour's pulse early
+//   - bumpers: front half of the body touching anything, split left/right,
+//     with contact bounce
+//   - encoders: A/B Gray code from each wheel's travel, one edge at a time
+// Everything random comes from the room seed, so a run can be replayed.
+
+#define ROBOT_RADIUS_CM      11.0
+#define WHEEL_BASE_CM        14.0
+#define TICKS_PER_CM         80.0    // x4 encoder ticks; WHEEL_CRUISE_TPS 2000 = 25 cm/s
+#define BUMPER_TRAVEL_CM     0.3     // switch closes this far before the shell touches
+#define BUMPER_ARC_DEG       80      // either side of straight ahead
+
+#define SONAR_MAX_CM         400.0
+#define SONAR_FAN_DEG        15      // half-width of the beam
+#define SONAR_RAYS           5
+#define SONAR_MAX_INCIDENCE  60      // flatter than this off the normal doesn't come back
+#define SONAR_DROPOUT_PCT    2
+
+#define WORLD_STEP_US        1000    // physics step
+#define COVER_CELL_CM        5.0
+
+struct WorldStats {
+    uint16_t contacts;        // times the body touched something
+    uint16_t hardContacts;    // ...at more than HARD_CONTACT_CM_S
+    bool trapped;             // no TRAP_RADIUS_CM of progress for TRAP_MS
+    float coverage;           // share of the floor the body can reach that it swept
+    float distanceCm;         // odometry of the body centre
+    float roomM2;
+};
+
+// New room and start pose from seed; call before setup()
+void worldGenerate(uint32_t seed);
+
+// Fires input edges due by the end of the next physics step, then runs it.
+// Leaves simNowUs at the end of the step (or later, if the firmware's own
+// delays ran past it).
+void worldStep();
+
+WorldStats worldStats();
+
+// Rover pose: cm and radians, x right, y up, heading 0 = +x
+void worldPose(float& x, float& y, float& heading);
+
+#endif